@@ -0,0 +1,406 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define _CHONKY_NUMS_PRINTING_UTILS_
+#define _CHONKY_NUMS_SPECIAL_TYPE_SUPPORT_
+#define _CHONKY_NUMS_UTILS_IMPLEMENTATION_
+#include "../chonky_nums.h"
+
+#ifdef CHONKY_BENCH_GMP
+	#include <gmp.h>
+#endif //CHONKY_BENCH_GMP
+
+// NOTE: Each case is sampled for about CHONKY_BENCH_BUDGET_NS, every sample
+// timing enough back to back operations to take CHONKY_BENCH_SAMPLE_NS, with
+// at least CHONKY_BENCH_MIN_SAMPLES samples however slow the operation is.
+#ifndef CHONKY_BENCH_BUDGET_NS
+	#define CHONKY_BENCH_BUDGET_NS 200000000ULL
+#endif //CHONKY_BENCH_BUDGET_NS
+
+#ifndef CHONKY_BENCH_SAMPLE_NS
+	#define CHONKY_BENCH_SAMPLE_NS 100000ULL
+#endif //CHONKY_BENCH_SAMPLE_NS
+
+#ifndef CHONKY_BENCH_MIN_SAMPLES
+	#define CHONKY_BENCH_MIN_SAMPLES 3
+#endif //CHONKY_BENCH_MIN_SAMPLES
+
+#ifndef CHONKY_BENCH_MAX_SAMPLES
+	#define CHONKY_BENCH_MAX_SAMPLES 1000
+#endif //CHONKY_BENCH_MAX_SAMPLES
+
+#define CHONKY_BENCH_MIN_BITS 64
+
+// Small c for the pseudo-Mersenne modulus 2^bits - c
+#define CHONKY_BENCH_MERSENNE_C 59
+
+/// -------------------------------
+///  Allocation Counters
+/// -------------------------------
+// NOTE: The Makefile links with --wrap for malloc, calloc and realloc, so that
+// every allocation of the library (and of GMP, through its memory functions)
+// goes through here.
+static u64 bench_allocs = 0;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+	bench_allocs++;
+	return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+	bench_allocs++;
+	return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+	bench_allocs++;
+	return __real_realloc(ptr, size);
+}
+
+/// -------------------------------
+///  Operands
+/// -------------------------------
+typedef struct BenchData {
+	u64 bits;
+	BigNum* a;
+	BigNum* b;
+	BigNum* x;
+	BigNum* mod;
+	BigNum* mersenne;
+	BigNum* exp;
+	BigNum* res;
+	char* str;
+	char* buf;
+	u64 buf_size;
+#ifdef CHONKY_BENCH_GMP
+	mpz_t gmp_a;
+	mpz_t gmp_b;
+	mpz_t gmp_x;
+	mpz_t gmp_mod;
+	mpz_t gmp_mersenne;
+	mpz_t gmp_exp;
+	mpz_t gmp_res;
+#endif //CHONKY_BENCH_GMP
+} BenchData;
+
+static u64 bench_rng_state = 0x9E3779B97F4A7C15ULL;
+
+static u64 bench_random(void) {
+	bench_rng_state ^= bench_rng_state << 13;
+	bench_rng_state ^= bench_rng_state >> 7;
+	bench_rng_state ^= bench_rng_state << 17;
+	return bench_rng_state;
+}
+
+// Random number of exactly bits bits, in a buffer of cap_limbs limbs.
+// NOTE: Every operand shares the capacity of the result, as the additions
+// read the operands up to the size of the result.
+static BigNum* bench_num(const u64 bits, const u64 cap_limbs, const bool is_odd) {
+	BigNum* num = alloc_chonky_num(NULL, cap_limbs * 8, 0);
+	if (num == NULL) return NULL;
+
+	const u64 n = (bits + 63) / 64;
+	for (u64 i = 0; i < n; ++i) (num -> data_64)[i] = bench_random();
+	if (bits % 64) (num -> data_64)[n - 1] &= (1ULL << (bits % 64)) - 1;
+	(num -> data_64)[(bits - 1) / 64] |= 1ULL << ((bits - 1) % 64);
+	if (is_odd) (num -> data_64)[0] |= 1;
+	num -> limbs = n;
+
+	return num;
+}
+
+// 2^bits - CHONKY_BENCH_MERSENNE_C
+static BigNum* bench_mersenne(const u64 bits, const u64 cap_limbs) {
+	BigNum* num = alloc_chonky_num(NULL, cap_limbs * 8, 0);
+	if (num == NULL) return NULL;
+
+	const u64 n = (bits + 63) / 64;
+	for (u64 i = 0; i < n; ++i) (num -> data_64)[i] = ~0ULL;
+	if (bits % 64) (num -> data_64)[n - 1] = (1ULL << (bits % 64)) - 1;
+	(num -> data_64)[0] -= CHONKY_BENCH_MERSENNE_C - 1;
+	num -> limbs = n;
+
+	return num;
+}
+
+static void bench_data_free(BenchData* data) {
+	BigNum* nums[] = { data -> a, data -> b, data -> x, data -> mod, data -> mersenne, data -> exp, data -> res };
+	for (u64 i = 0; i < ARR_SIZE(nums); ++i) {
+		if (nums[i] != NULL) dealloc_chonky_num(nums[i]);
+	}
+	free(data -> str);
+	free(data -> buf);
+
+#ifdef CHONKY_BENCH_GMP
+	mpz_clears(data -> gmp_a, data -> gmp_b, data -> gmp_x, data -> gmp_mod, data -> gmp_mersenne, data -> gmp_exp, data -> gmp_res, NULL);
+#endif //CHONKY_BENCH_GMP
+
+	memset(data, 0, sizeof(BenchData));
+
+	return;
+}
+
+// a, b, mod and exp take bits bits, x twice as many, so that the divisions
+// and the reductions work on a full double-size dividend.
+static bool bench_data_init(BenchData* data, const u64 bits) {
+	memset(data, 0, sizeof(BenchData));
+	data -> bits = bits;
+
+	const u64 cap_limbs = 2 * ((bits + 63) / 64) + 2;
+	data -> a = bench_num(bits, cap_limbs, FALSE);
+	data -> b = bench_num(bits, cap_limbs, FALSE);
+	data -> x = bench_num(2 * bits, cap_limbs, FALSE);
+	data -> mod = bench_num(bits, cap_limbs, TRUE);
+	data -> mersenne = bench_mersenne(bits, cap_limbs);
+	data -> exp = bench_num(bits, cap_limbs, FALSE);
+	data -> res = alloc_chonky_num(NULL, cap_limbs * 8, 0);
+	if (data -> a == NULL || data -> b == NULL || data -> x == NULL || data -> mod == NULL || data -> mersenne == NULL || data -> exp == NULL || data -> res == NULL) {
+		bench_data_free(data);
+		return FALSE;
+	}
+
+	data -> buf_size = chonky_dec_string_size(data -> a);
+	data -> str = calloc(data -> buf_size, sizeof(char));
+	data -> buf = calloc(data -> buf_size, sizeof(char));
+	if (data -> str == NULL || data -> buf == NULL || chonky_to_dec_string(data -> a, data -> str, data -> buf_size) == 0) {
+		bench_data_free(data);
+		return FALSE;
+	}
+
+#ifdef CHONKY_BENCH_GMP
+	mpz_inits(data -> gmp_a, data -> gmp_b, data -> gmp_x, data -> gmp_mod, data -> gmp_mersenne, data -> gmp_exp, data -> gmp_res, NULL);
+	mpz_import(data -> gmp_a, data -> a -> limbs, -1, 8, 0, 0, data -> a -> data);
+	mpz_import(data -> gmp_b, data -> b -> limbs, -1, 8, 0, 0, data -> b -> data);
+	mpz_import(data -> gmp_x, data -> x -> limbs, -1, 8, 0, 0, data -> x -> data);
+	mpz_import(data -> gmp_mod, data -> mod -> limbs, -1, 8, 0, 0, data -> mod -> data);
+	mpz_import(data -> gmp_mersenne, data -> mersenne -> limbs, -1, 8, 0, 0, data -> mersenne -> data);
+	mpz_import(data -> gmp_exp, data -> exp -> limbs, -1, 8, 0, 0, data -> exp -> data);
+#endif //CHONKY_BENCH_GMP
+
+	return TRUE;
+}
+
+/// -------------------------------
+///  Cases
+/// -------------------------------
+static bool bench_add(BenchData* data) { return chonky_add_into(data -> res, data -> a, data -> b) != NULL; }
+static bool bench_sub(BenchData* data) { return chonky_sub_into(data -> res, data -> a, data -> b) != NULL; }
+static bool bench_mul(BenchData* data) { return chonky_mul_into(data -> res, data -> a, data -> b) != NULL; }
+static bool bench_sqr(BenchData* data) { return chonky_sqr_into(data -> res, data -> a) != NULL; }
+static bool bench_div(BenchData* data) { return chonky_div_into(data -> res, data -> x, data -> a) != NULL; }
+static bool bench_mod(BenchData* data) { return chonky_mod_into(data -> res, data -> x, data -> mod) != NULL; }
+static bool bench_mod_mersenne(BenchData* data) { return chonky_mod_mersenne_into(data -> res, data -> x, data -> mersenne) != NULL; }
+static bool bench_pow_mod(BenchData* data) { return chonky_pow_mod_into(data -> res, data -> a, data -> exp, data -> mod) != NULL; }
+static bool bench_print(BenchData* data) { return chonky_to_dec_string(data -> a, data -> buf, data -> buf_size) != 0; }
+
+static bool bench_parse(BenchData* data) {
+	BigNum* num = alloc_chonky_num_from_string(data -> str);
+	if (num == NULL) return FALSE;
+	dealloc_chonky_num(num);
+	return TRUE;
+}
+
+#ifdef CHONKY_BENCH_GMP
+static bool bench_gmp_add(BenchData* data) { mpz_add(data -> gmp_res, data -> gmp_a, data -> gmp_b); return TRUE; }
+static bool bench_gmp_sub(BenchData* data) { mpz_sub(data -> gmp_res, data -> gmp_a, data -> gmp_b); return TRUE; }
+static bool bench_gmp_mul(BenchData* data) { mpz_mul(data -> gmp_res, data -> gmp_a, data -> gmp_b); return TRUE; }
+static bool bench_gmp_sqr(BenchData* data) { mpz_mul(data -> gmp_res, data -> gmp_a, data -> gmp_a); return TRUE; }
+static bool bench_gmp_div(BenchData* data) { mpz_tdiv_q(data -> gmp_res, data -> gmp_x, data -> gmp_a); return TRUE; }
+static bool bench_gmp_mod(BenchData* data) { mpz_mod(data -> gmp_res, data -> gmp_x, data -> gmp_mod); return TRUE; }
+static bool bench_gmp_mod_mersenne(BenchData* data) { mpz_mod(data -> gmp_res, data -> gmp_x, data -> gmp_mersenne); return TRUE; }
+static bool bench_gmp_pow_mod(BenchData* data) { mpz_powm(data -> gmp_res, data -> gmp_a, data -> gmp_exp, data -> gmp_mod); return TRUE; }
+static bool bench_gmp_parse(BenchData* data) { return mpz_set_str(data -> gmp_res, data -> str, 10) == 0; }
+static bool bench_gmp_print(BenchData* data) { return mpz_get_str(data -> buf, 10, data -> gmp_a) != NULL; }
+
+static void* bench_gmp_alloc(size_t size) { return malloc(size); }
+static void* bench_gmp_realloc(void* ptr, size_t old_size, size_t size) { (void) old_size; return realloc(ptr, size); }
+static void bench_gmp_free(void* ptr, size_t size) { (void) size; free(ptr); }
+#endif //CHONKY_BENCH_GMP
+
+typedef struct BenchCase {
+	const char* name;
+	u64 max_bits;
+	bool (*run)(BenchData* data);
+#ifdef CHONKY_BENCH_GMP
+	bool (*gmp_run)(BenchData* data);
+	#define BENCH_CASE(name, max_bits) { #name, max_bits, bench_##name, bench_gmp_##name }
+#else
+	#define BENCH_CASE(name, max_bits) { #name, max_bits, bench_##name }
+#endif //CHONKY_BENCH_GMP
+} BenchCase;
+
+// NOTE: The exponentiation grows cubically, so it stops way earlier
+static const BenchCase bench_cases[] = {
+	BENCH_CASE(add, 1ULL << 20),
+	BENCH_CASE(sub, 1ULL << 20),
+	BENCH_CASE(mul, 1ULL << 20),
+	BENCH_CASE(sqr, 1ULL << 20),
+	BENCH_CASE(div, 1ULL << 20),
+	BENCH_CASE(mod, 1ULL << 20),
+	BENCH_CASE(mod_mersenne, 1ULL << 20),
+	BENCH_CASE(pow_mod, 1ULL << 13),
+	BENCH_CASE(parse, 1ULL << 20),
+	BENCH_CASE(print, 1ULL << 20),
+};
+
+/// -------------------------------
+///  Sampling
+/// -------------------------------
+typedef struct BenchResult {
+	double ns_per_op;
+	double p50_ns;
+	double p99_ns;
+	double allocs_per_op;
+	u64 samples;
+} BenchResult;
+
+static u64 bench_now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int bench_cmp_double(const void* a, const void* b) {
+	const double x = *(const double*) a;
+	const double y = *(const double*) b;
+	return (x > y) - (x < y);
+}
+
+static bool bench_sample(bool (*run)(BenchData* data), BenchData* data, BenchResult* result) {
+	static double samples[CHONKY_BENCH_MAX_SAMPLES];
+
+	// The first run warms up the caches and sizes the samples
+	u64 start = bench_now_ns();
+	if (!run(data)) return FALSE;
+	const u64 first_ns = MAX(bench_now_ns() - start, 1);
+	const u64 reps = MAX(CHONKY_BENCH_SAMPLE_NS / first_ns, 1);
+
+	u64 total_ns = 0;
+	u64 total_ops = 0;
+	u64 count = 0;
+	const u64 allocs = bench_allocs;
+	while (count < CHONKY_BENCH_MAX_SAMPLES && (count < CHONKY_BENCH_MIN_SAMPLES || total_ns < CHONKY_BENCH_BUDGET_NS)) {
+		start = bench_now_ns();
+		for (u64 i = 0; i < reps; ++i) {
+			if (!run(data)) return FALSE;
+		}
+		const u64 elapsed = bench_now_ns() - start;
+
+		samples[count++] = (double) elapsed / reps;
+		total_ns += elapsed;
+		total_ops += reps;
+	}
+
+	qsort(samples, count, sizeof(double), bench_cmp_double);
+	result -> ns_per_op = (double) total_ns / total_ops;
+	result -> p50_ns = samples[(count - 1) * 50 / 100];
+	result -> p99_ns = samples[(count - 1) * 99 / 100];
+	result -> allocs_per_op = (double) (bench_allocs - allocs) / total_ops;
+	result -> samples = count;
+
+	return TRUE;
+}
+
+/// -------------------------------
+///  Output
+/// -------------------------------
+static bool bench_is_json = FALSE;
+static u64 bench_rows = 0;
+
+static void bench_print_header(void) {
+	if (bench_is_json) printf("[\n");
+	else printf("library,op,bits,ns_per_op,p50_ns,p99_ns,allocs_per_op,samples\n");
+	return;
+}
+
+static void bench_print_row(const char* library, const char* op, const u64 bits, const BenchResult* result) {
+	if (bench_is_json) {
+		printf("%s  {\"library\": \"%s\", \"op\": \"%s\", \"bits\": %llu, \"ns_per_op\": %.1f, \"p50_ns\": %.1f, \"p99_ns\": %.1f, \"allocs_per_op\": %.3f, \"samples\": %llu}",
+			bench_rows ? ",\n" : "", library, op, bits, result -> ns_per_op, result -> p50_ns, result -> p99_ns, result -> allocs_per_op, result -> samples);
+	} else {
+		printf("%s,%s,%llu,%.1f,%.1f,%.1f,%.3f,%llu\n", library, op, bits, result -> ns_per_op, result -> p50_ns, result -> p99_ns, result -> allocs_per_op, result -> samples);
+	}
+
+	bench_rows++;
+	fflush(stdout);
+
+	return;
+}
+
+static void bench_print_footer(void) {
+	if (bench_is_json) printf("\n]\n");
+	return;
+}
+
+// Whether op is listed in the comma separated ops, "all" listing every one
+static bool bench_is_selected(const char* ops, const char* op) {
+	if (strcmp(ops, "all") == 0) return TRUE;
+
+	const u64 len = strlen(op);
+	for (const char* cur = ops; cur != NULL; cur = strchr(cur, ',')) {
+		if (*cur == ',') cur++;
+		if (strncmp(cur, op, len) == 0 && (cur[len] == ',' || cur[len] == '\0')) return TRUE;
+	}
+
+	return FALSE;
+}
+
+int main(int argc, char** argv) {
+	if (argc > 4 || (argc > 1 && strcmp(argv[1], "csv") != 0 && strcmp(argv[1], "json") != 0)) {
+		fprintf(stderr, "Usage: %s [csv|json] [max_bits] [all|op,op,...]\n", argv[0]);
+		return 1;
+	}
+
+	bench_is_json = (argc > 1 && strcmp(argv[1], "json") == 0);
+	const u64 max_bits = (argc > 2) ? strtoull(argv[2], NULL, 10) : (1ULL << 20);
+	const char* ops = (argc > 3) ? argv[3] : "all";
+
+#ifdef CHONKY_BENCH_GMP
+	mp_set_memory_functions(bench_gmp_alloc, bench_gmp_realloc, bench_gmp_free);
+#endif //CHONKY_BENCH_GMP
+
+	bench_print_header();
+
+	for (u64 bits = CHONKY_BENCH_MIN_BITS; bits <= max_bits; bits *= 2) {
+		BenchData data = {0};
+		if (!bench_data_init(&data, bits)) {
+			fprintf(stderr, "Failed to allocate the operands of %llu bits.\n", bits);
+			return 1;
+		}
+
+		for (u64 i = 0; i < ARR_SIZE(bench_cases); ++i) {
+			const BenchCase* bench_case = bench_cases + i;
+			if (bits > bench_case -> max_bits || !bench_is_selected(ops, bench_case -> name)) continue;
+
+			BenchResult result = {0};
+			if (!bench_sample(bench_case -> run, &data, &result)) {
+				fprintf(stderr, "Failed to run %s over %llu bits.\n", bench_case -> name, bits);
+				bench_data_free(&data);
+				return 1;
+			}
+			bench_print_row("chonky", bench_case -> name, bits, &result);
+
+#ifdef CHONKY_BENCH_GMP
+			if (!bench_sample(bench_case -> gmp_run, &data, &result)) {
+				fprintf(stderr, "Failed to run %s over %llu bits through GMP.\n", bench_case -> name, bits);
+				bench_data_free(&data);
+				return 1;
+			}
+			bench_print_row("gmp", bench_case -> name, bits, &result);
+#endif //CHONKY_BENCH_GMP
+		}
+
+		bench_data_free(&data);
+	}
+
+	bench_print_footer();
+
+	return 0;
+}
+
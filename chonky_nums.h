@@ -125,15 +125,6 @@ static void chonky_assert(bool condition, const char* condition_str, const char*
 
 #endif //CHONKY_ASSERT
 
-static u8 bit_size(u8 val) {
-	u8 size = 8;
-	for (s8 i = size - 1; i >= 0; --i) {
-		if (GET_BIT(val, i)) break;
-		size--;
-	}
-	return size;
-}
-
 static size_t str_len(const char* str) {
     if (str == NULL) return 0;
     const char* str_c = str;
@@ -156,16 +147,6 @@ static void mem_set_var(void* ptr, int value, size_t size, size_t val_size) {
 	return;
 }
 
-static char* reverse_str(char* str) {
-    int len = str_len(str);
-    for (int i = 0; i < (len / 2); ++i) {
-        char temp = str[i];
-        str[i] = str[len - i - 1];
-        str[len - i - 1] = temp;
-    }
-    return str;
-}
-
 #endif // _CHONKY_NUMS_UTILS_IMPLEMENTATION_
 
 #if defined(__aarch64__) || defined(__arm__)
@@ -201,6 +182,463 @@ static char* reverse_str(char* str) {
 	#include <immintrin.h>
 #endif
 
+/// -------------------------------
+///  Memory Pool
+/// -------------------------------
+// NOTE: Opt-in pool allocator, once a pool is installed on a thread through
+// chonky_pool_use, every allocation made by the library on that thread comes
+// from it. Blocks are rounded up to power of two size classes, carved out of
+// big chunks and recycled through per-class free lists, while the blocks
+// bigger than the last class go straight to the heap. A mark remembers the
+// state of the pool, resetting to it releases in one go everything allocated
+// after the mark, BigNums and contexts included.
+// NOTE: A pool is not thread-safe, each thread should install its own.
+#ifndef CHONKY_POOL_CHUNK_SIZE
+	#define CHONKY_POOL_CHUNK_SIZE (1ULL << 20)
+#endif //CHONKY_POOL_CHUNK_SIZE
+
+// Classes go from 16 bytes up to 16 * 2^(CHONKY_POOL_CLASSES - 1) bytes
+#ifndef CHONKY_POOL_CLASSES
+	#define CHONKY_POOL_CLASSES 16
+#endif //CHONKY_POOL_CLASSES
+
+#ifndef CHONKY_POOL_MAX_MARKS
+	#define CHONKY_POOL_MAX_MARKS 32
+#endif //CHONKY_POOL_MAX_MARKS
+
+#define CHONKY_POOL_MIN_SHIFT 4
+#define CHONKY_POOL_LARGE     CHONKY_POOL_CLASSES
+
+// Header in front of every block, it keeps the 16 bytes alignment
+typedef struct ChonkyPoolBlock {
+	struct ChonkyPoolBlock* next;
+	struct ChonkyPoolBlock* prev;
+	struct ChonkyPool* pool;
+	u64 serial;
+	u64 size_class;
+	u64 size;
+} ChonkyPoolBlock;
+
+typedef struct ChonkyPoolChunk {
+	struct ChonkyPoolChunk* prev;
+	u64 size;
+	u64 used;
+	u64 padding;
+} ChonkyPoolChunk;
+
+// Every mark level keeps its own free lists, so that a reset never hands
+// out memory that is about to be rewound.
+typedef struct ChonkyPoolMark {
+	ChonkyPoolChunk* chunk;
+	u64 used;
+	u64 serial;
+	ChonkyPoolBlock* free_lists[CHONKY_POOL_CLASSES];
+} ChonkyPoolMark;
+
+EXPORT_STRUCTURE typedef struct ChonkyPool {
+	void* chunks;
+	void* large;
+	void* free_lists;
+	void* marks;
+	u64 marks_count;
+	u64 chunk_size;
+	u64 serial;
+} ChonkyPool;
+
+static _Thread_local ChonkyPool* __chonky_thread_pool = NULL;
+
+static inline u64 __chonky_pool_class(const u64 size) {
+	if (size <= (1ULL << CHONKY_POOL_MIN_SHIFT)) return 0;
+	return MIN((u64) (64 - __builtin_clzll(size - 1) - CHONKY_POOL_MIN_SHIFT), CHONKY_POOL_LARGE);
+}
+
+static ChonkyPoolBlock** __chonky_pool_level_lists(ChonkyPool* pool, const u64 serial) {
+	ChonkyPoolMark* marks = (ChonkyPoolMark*) pool -> marks;
+	
+	// The block belongs to the level of the last mark taken before it
+	u64 level = pool -> marks_count;
+	while (level > 0 && marks[level - 1].serial > serial) level--;
+	
+	if (level == pool -> marks_count) return (ChonkyPoolBlock**) pool -> free_lists;
+	return marks[level].free_lists;
+}
+
+CHONKY_FAILABLE static void* __chonky_pool_alloc(ChonkyPool* pool, const u64 size) {
+	const u64 size_class = __chonky_pool_class(size);
+	ChonkyPoolBlock** free_lists = (ChonkyPoolBlock**) pool -> free_lists;
+	ChonkyPoolBlock* block = NULL;
+
+	if (size_class == CHONKY_POOL_LARGE) {
+		block = malloc(sizeof(ChonkyPoolBlock) + size);
+		if (block == NULL) {
+			WARNING_LOG("Failed to allocate pool block of %llu bytes.", size);
+			return NULL;
+		}
+		
+		block -> prev = NULL;
+		block -> next = (ChonkyPoolBlock*) pool -> large;
+		if (block -> next != NULL) block -> next -> prev = block;
+		pool -> large = block;
+	} else if (free_lists[size_class] != NULL) {
+		block = free_lists[size_class];
+		free_lists[size_class] = block -> next;
+	} else {
+		const u64 block_size = sizeof(ChonkyPoolBlock) + (1ULL << (size_class + CHONKY_POOL_MIN_SHIFT));
+		ChonkyPoolChunk* chunk = (ChonkyPoolChunk*) pool -> chunks;
+		if (chunk == NULL || chunk -> used + block_size > chunk -> size) {
+			const u64 chunk_size = MAX(pool -> chunk_size, block_size);
+			ChonkyPoolChunk* new_chunk = malloc(sizeof(ChonkyPoolChunk) + chunk_size);
+			if (new_chunk == NULL) {
+				WARNING_LOG("Failed to allocate pool chunk of %llu bytes.", chunk_size);
+				return NULL;
+			}
+			
+			new_chunk -> prev = chunk;
+			new_chunk -> size = chunk_size;
+			new_chunk -> used = 0;
+			pool -> chunks = new_chunk;
+			chunk = new_chunk;
+		}
+
+		block = (ChonkyPoolBlock*) ((u8*) (chunk + 1) + chunk -> used);
+		chunk -> used += block_size;
+	}
+
+	block -> pool = pool;
+	block -> serial = (pool -> serial)++;
+	block -> size_class = size_class;
+	block -> size = size;
+
+	return block + 1;
+}
+
+static void __chonky_pool_free(void* ptr) {
+	if (ptr == NULL) return;
+	
+	ChonkyPoolBlock* block = ((ChonkyPoolBlock*) ptr) - 1;
+	ChonkyPool* pool = block -> pool;
+	
+	if (block -> size_class == CHONKY_POOL_LARGE) {
+		if (block -> prev != NULL) block -> prev -> next = block -> next;
+		else pool -> large = block -> next;
+		if (block -> next != NULL) block -> next -> prev = block -> prev;
+		free(block);
+		return;
+	}
+
+	ChonkyPoolBlock** free_lists = __chonky_pool_level_lists(pool, block -> serial);
+	block -> next = free_lists[block -> size_class];
+	free_lists[block -> size_class] = block;
+
+	return;
+}
+
+CHONKY_FAILABLE static void* __chonky_pool_realloc(void* ptr, const u64 size) {
+	ChonkyPoolBlock* block = ((ChonkyPoolBlock*) ptr) - 1;
+	if (block -> size_class < CHONKY_POOL_LARGE && size <= (1ULL << (block -> size_class + CHONKY_POOL_MIN_SHIFT))) {
+		block -> size = size;
+		return ptr;
+	}
+	
+	void* new_ptr = __chonky_pool_alloc(block -> pool, size);
+	if (new_ptr == NULL) return NULL;
+	
+	__builtin_memcpy(new_ptr, ptr, MIN(block -> size, size));
+	__chonky_pool_free(ptr);
+	
+	return new_ptr;
+}
+
+// Allocations of the library, served by the pool installed on the thread
+CHONKY_FAILABLE static inline void* __chonky_calloc(const u64 count, const u64 size) {
+	if (__chonky_thread_pool == NULL) return calloc(count, size);
+	void* ptr = __chonky_pool_alloc(__chonky_thread_pool, count * size);
+	if (ptr != NULL) __builtin_memset(ptr, 0, count * size);
+	return ptr;
+}
+
+// NOTE: Only valid for memory allocated during the same call, as the pool
+// installed on the thread might change in between.
+static inline void __chonky_free(void* ptr) {
+	if (__chonky_thread_pool == NULL) free(ptr);
+	else __chonky_pool_free(ptr);
+	return;
+}
+
+// Memory kept across calls goes back to where it came from, as recorded by
+// its owner when allocated, regardless of the pool currently installed.
+static inline void __chonky_release(const bool is_pooled, void* ptr) {
+	if (is_pooled) __chonky_pool_free(ptr);
+	else free(ptr);
+	return;
+}
+
+EXPORT_FUNCTION ChonkyPool* alloc_chonky_pool(u64 chunk_size) {
+	ChonkyPool* pool = calloc(1, sizeof(ChonkyPool));
+	if (pool == NULL) {
+		WARNING_LOG("Failed to allocate pool.");
+		return NULL;
+	}
+
+	pool -> chunk_size = chunk_size ? chunk_size : CHONKY_POOL_CHUNK_SIZE;
+	pool -> free_lists = calloc(CHONKY_POOL_CLASSES, sizeof(ChonkyPoolBlock*));
+	pool -> marks = calloc(CHONKY_POOL_MAX_MARKS, sizeof(ChonkyPoolMark));
+	if (pool -> free_lists == NULL || pool -> marks == NULL) {
+		SAFE_FREE(pool -> free_lists);
+		SAFE_FREE(pool -> marks);
+		free(pool);
+		WARNING_LOG("Failed to allocate pool buffers.");
+		return NULL;
+	}
+
+	return pool;
+}
+
+EXPORT_FUNCTION void dealloc_chonky_pool(ChonkyPool* pool) {
+	if (pool == NULL) return;
+	if (__chonky_thread_pool == pool) __chonky_thread_pool = NULL;
+
+	for (ChonkyPoolChunk* chunk = (ChonkyPoolChunk*) pool -> chunks; chunk != NULL;) {
+		ChonkyPoolChunk* prev = chunk -> prev;
+		free(chunk);
+		chunk = prev;
+	}
+
+	for (ChonkyPoolBlock* block = (ChonkyPoolBlock*) pool -> large; block != NULL;) {
+		ChonkyPoolBlock* next = block -> next;
+		free(block);
+		block = next;
+	}
+
+	free(pool -> free_lists);
+	free(pool -> marks);
+	free(pool);
+
+	return;
+}
+
+// Installs the pool on the calling thread (NULL goes back to the heap),
+// returns the one previously installed.
+EXPORT_FUNCTION ChonkyPool* chonky_pool_use(ChonkyPool* pool) {
+	ChonkyPool* prev = __chonky_thread_pool;
+	__chonky_thread_pool = pool;
+	return prev;
+}
+
+// Returns the mark to pass to chonky_pool_reset, or -1 if there are already
+// CHONKY_POOL_MAX_MARKS nested marks.
+EXPORT_FUNCTION s64 chonky_pool_mark(ChonkyPool* pool) {
+	if (pool == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return -1;
+	} else if (pool -> marks_count == CHONKY_POOL_MAX_MARKS) {
+		WARNING_LOG("Too many nested marks, the limit is %u.", CHONKY_POOL_MAX_MARKS);
+		return -1;
+	}
+
+	ChonkyPoolMark* mark = (ChonkyPoolMark*) pool -> marks + pool -> marks_count;
+	ChonkyPoolBlock** free_lists = (ChonkyPoolBlock**) pool -> free_lists;
+	
+	mark -> chunk = (ChonkyPoolChunk*) pool -> chunks;
+	mark -> used = (mark -> chunk != NULL) ? mark -> chunk -> used : 0;
+	mark -> serial = pool -> serial;
+	for (u64 i = 0; i < CHONKY_POOL_CLASSES; ++i) {
+		mark -> free_lists[i] = free_lists[i];
+		free_lists[i] = NULL;
+	}
+
+	return (pool -> marks_count)++;
+}
+
+// Releases everything allocated after the mark, as well as the marks taken
+// after it, the mark itself included.
+EXPORT_FUNCTION void chonky_pool_reset(ChonkyPool* pool, s64 mark_idx) {
+	if (pool == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return;
+	} else if (mark_idx < 0 || (u64) mark_idx >= pool -> marks_count) {
+		WARNING_LOG("Invalid mark %lld, only %llu marks are active.", mark_idx, pool -> marks_count);
+		return;
+	}
+
+	ChonkyPoolMark* mark = (ChonkyPoolMark*) pool -> marks + mark_idx;
+	
+	// Rewind the chunks
+	ChonkyPoolChunk* chunk = (ChonkyPoolChunk*) pool -> chunks;
+	while (chunk != mark -> chunk) {
+		ChonkyPoolChunk* prev = chunk -> prev;
+		free(chunk);
+		chunk = prev;
+	}
+	
+	pool -> chunks = chunk;
+	if (chunk != NULL) chunk -> used = mark -> used;
+
+	// Large blocks are kept from the newest, so the ones after the mark come first
+	ChonkyPoolBlock* block = (ChonkyPoolBlock*) pool -> large;
+	while (block != NULL && block -> serial >= mark -> serial) {
+		ChonkyPoolBlock* next = block -> next;
+		free(block);
+		block = next;
+	}
+	
+	if (block != NULL) block -> prev = NULL;
+	pool -> large = block;
+
+	ChonkyPoolBlock** free_lists = (ChonkyPoolBlock**) pool -> free_lists;
+	for (u64 i = 0; i < CHONKY_POOL_CLASSES; ++i) free_lists[i] = mark -> free_lists[i];
+	
+	pool -> marks_count = mark_idx;
+
+	return;
+}
+
+/// -------------------------------
+///  Worker Threads
+/// -------------------------------
+// NOTE: Opt-in workers for the biggest multiplications, started through
+// chonky_set_workers. Independent tasks are queued in groups, the thread
+// queuing a group runs its first task and then takes back the ones still
+// queued, waiting only for those already picked up by a worker, so that
+// nested groups can not starve the workers. Without workers, or below
+// CHONKY_PARALLEL_THRESHOLD limbs, the tasks run in order on the calling
+// thread. Workers do not inherit the memory pool of the thread queuing the
+// tasks, they allocate from the heap.
+#include <pthread.h>
+
+// Operand size, in limbs, from which the subproducts are spread across the workers
+#ifndef CHONKY_PARALLEL_THRESHOLD
+	#define CHONKY_PARALLEL_THRESHOLD 2048
+#endif //CHONKY_PARALLEL_THRESHOLD
+
+#ifndef CHONKY_MAX_WORKERS
+	#define CHONKY_MAX_WORKERS 64
+#endif //CHONKY_MAX_WORKERS
+
+typedef struct ChonkyTask {
+	bool (*run)(void* arg);
+	void* arg;
+	bool is_failed;
+	bool is_done;
+	struct ChonkyTask* next;
+} ChonkyTask;
+
+typedef struct ChonkyWorkers {
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	pthread_cond_t done;
+	pthread_t threads[CHONKY_MAX_WORKERS];
+	ChonkyTask* queue;
+	u64 count;
+	bool is_stopping;
+} ChonkyWorkers;
+
+static ChonkyWorkers __chonky_workers = { .lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER, .done = PTHREAD_COND_INITIALIZER };
+
+// Runs the task outside of the lock, which must be held, then marks it as done
+static void __chonky_task_exec(ChonkyTask* task) {
+	pthread_mutex_unlock(&__chonky_workers.lock);
+	const bool is_failed = !task -> run(task -> arg);
+	pthread_mutex_lock(&__chonky_workers.lock);
+	
+	task -> is_failed = is_failed;
+	task -> is_done = TRUE;
+	pthread_cond_broadcast(&__chonky_workers.done);
+	
+	return;
+}
+
+static void* __chonky_worker_loop(void* arg) {
+	(void) arg;
+	pthread_mutex_lock(&__chonky_workers.lock);
+	
+	while (!__chonky_workers.is_stopping) {
+		ChonkyTask* task = __chonky_workers.queue;
+		if (task == NULL) {
+			pthread_cond_wait(&__chonky_workers.wake, &__chonky_workers.lock);
+			continue;
+		}
+		
+		__chonky_workers.queue = task -> next;
+		__chonky_task_exec(task);
+	}
+	
+	pthread_mutex_unlock(&__chonky_workers.lock);
+	
+	return NULL;
+}
+
+// Runs the group of tasks, size being the one of the operation they split.
+// NOTE: Returns FALSE when any of the tasks failed
+static bool __chonky_tasks_run(ChonkyTask* tasks, const u64 count, const u64 size) {
+	if (__chonky_workers.count == 0 || size < CHONKY_PARALLEL_THRESHOLD) {
+		for (u64 i = 0; i < count; ++i) {
+			if (!tasks[i].run(tasks[i].arg)) return FALSE;
+		}
+		return TRUE;
+	}
+
+	pthread_mutex_lock(&__chonky_workers.lock);
+	
+	for (u64 i = count - 1; i > 0; --i) {
+		tasks[i].next = __chonky_workers.queue;
+		__chonky_workers.queue = tasks + i;
+	}
+	pthread_cond_broadcast(&__chonky_workers.wake);
+	
+	__chonky_task_exec(tasks);
+	
+	bool is_failed = tasks[0].is_failed;
+	for (u64 i = 1; i < count; ++i) {
+		while (!tasks[i].is_done) {
+			ChonkyTask** link = &__chonky_workers.queue;
+			while (*link != NULL && *link != tasks + i) link = &((*link) -> next);
+			
+			if (*link != NULL) {
+				*link = tasks[i].next;
+				__chonky_task_exec(tasks + i);
+			} else {
+				pthread_cond_wait(&__chonky_workers.done, &__chonky_workers.lock);
+			}
+		}
+		is_failed |= tasks[i].is_failed;
+	}
+	
+	pthread_mutex_unlock(&__chonky_workers.lock);
+
+	return !is_failed;
+}
+
+// Replaces the running workers with count new ones, 0 only stops them,
+// returns the number of workers actually started.
+// NOTE: Must not be called while another thread is using the library
+EXPORT_FUNCTION u64 chonky_set_workers(u64 count) {
+	pthread_mutex_lock(&__chonky_workers.lock);
+	__chonky_workers.is_stopping = TRUE;
+	pthread_cond_broadcast(&__chonky_workers.wake);
+	pthread_mutex_unlock(&__chonky_workers.lock);
+
+	for (u64 i = 0; i < __chonky_workers.count; ++i) pthread_join(__chonky_workers.threads[i], NULL);
+	
+	__chonky_workers.count = 0;
+	__chonky_workers.is_stopping = FALSE;
+	
+	if (count > CHONKY_MAX_WORKERS) {
+		WARNING_LOG("Capping the workers to %u.", CHONKY_MAX_WORKERS);
+		count = CHONKY_MAX_WORKERS;
+	}
+
+	for (u64 i = 0; i < count; ++i) {
+		if (pthread_create(__chonky_workers.threads + i, NULL, __chonky_worker_loop, NULL) != 0) {
+			WARNING_LOG("Failed to start worker %llu.", i);
+			break;
+		}
+		__chonky_workers.count++;
+	}
+
+	return __chonky_workers.count;
+}
+
 // TODO: Refactor a bit and clean (also maybe some extra debug/warning prints
 // for easier tracking of faults/errors).
 /// -----------------------------------------
@@ -210,18 +648,29 @@ static char* reverse_str(char* str) {
 /// NOTE: This method is not really safe, as it requires the size to be a
 /// multiple of 8, as well as being sure that the data will be still valid for
 /// the same amount of time as the BigNum.
-#define STATIC_BIG_NUM(_data, _size, _sign) ((BigNum) { .data = (u8*) (_data), .size = (_size), .sign = (_sign), .is_freeable = FALSE }) 
-#define POS_STATIC_BIG_NUM(_data, _size)    ((BigNum) { .data = (u8*) (_data), .size = (_size), .sign = 0, .is_freeable = FALSE }) 
+#define STATIC_BIG_NUM(_data, _size, _sign) ((BigNum) { .data = (u8*) (_data), .size = (_size), .limbs = __chonky_limbs_real_size((u64*) (_data), (_size) / 8), .sign = (_sign), .is_freeable = FALSE }) 
+#define POS_STATIC_BIG_NUM(_data, _size)    ((BigNum) { .data = (u8*) (_data), .size = (_size), .limbs = __chonky_limbs_real_size((u64*) (_data), (_size) / 8), .sign = 0, .is_freeable = FALSE }) 
 #define IS_VALID_BIG_NUM(num)               (((num) != NULL) && ((num) -> data != NULL))
 
+// Numbers up to this many limbs keep them inside the BigNum itself, saving
+// the allocation of the data buffer, they move to the heap once they grow.
+#ifndef CHONKY_INLINE_LIMBS
+	#define CHONKY_INLINE_LIMBS 4
+#endif //CHONKY_INLINE_LIMBS
+
+#define IS_CHONKY_INLINE(num) ((num) -> data_64 == (num) -> inline_limbs)
+
 EXPORT_STRUCTURE typedef struct BigNum {
 	union {
 		u8* data;
 		u64* data_64;
 	};
 	u64 size;
+	u64 limbs;
 	u8 sign;
 	u8 is_freeable;
+	u8 is_pooled;
+	u64 inline_limbs[CHONKY_INLINE_LIMBS];
 } BigNum;
 
 static inline u64 align_64(u64 val) {
@@ -229,8 +678,24 @@ static inline u64 align_64(u64 val) {
 	return val + (val % 8 ? (8 - (val % 8)) : 0);
 }
 
+static inline u64 __chonky_limbs_real_size(const u64* ap, u64 n) {
+	while (n > 0 && ap[n - 1] == 0) n--;
+	return n;
+}
+
+// NOTE: Every operation writing a BigNum updates its used limbs (the limbs
+// without the leading zero ones), the limbs from `bound` onwards are known to
+// be zero, so that the scan usually stops right away.
+static inline BigNum* __chonky_trim(BigNum* num, const u64 bound) {
+	num -> limbs = __chonky_limbs_real_size(num -> data_64, bound);
+	return num;
+}
+
+// NOTE: When a pool is installed on the thread both the BigNum and its data
+// come from it, the BigNum remembers it, so that it can be resized and freed
+// even after the pool has been uninstalled.
 EXPORT_FUNCTION BigNum* alloc_chonky_num(const u8* data, const u64 size, bool sign) {
-	BigNum* num = calloc(1, sizeof(BigNum));
+	BigNum* num = __chonky_calloc(1, sizeof(BigNum));
 	if (num == NULL) {
 		WARNING_LOG("Failed to allocate BigNum.");
 		return NULL;
@@ -238,16 +703,22 @@ EXPORT_FUNCTION BigNum* alloc_chonky_num(const u8* data, const u64 size, bool si
 
 	num -> sign = sign;
 	num -> is_freeable = TRUE;
+	num -> is_pooled = (__chonky_thread_pool != NULL);
 	num -> size = align_64(size);
 
-	num -> data = (u8*) calloc(num -> size, sizeof(u8));
+	if (num -> size <= sizeof(num -> inline_limbs)) num -> data_64 = num -> inline_limbs;
+	else num -> data = (u8*) __chonky_calloc(num -> size, sizeof(u8));
+	
 	if (num -> data == NULL) {
-		free(num);
+		__chonky_free(num);
 		WARNING_LOG("Failed to allocate data buffer.");
 		return NULL;
 	}
 	
-	if (data != NULL) mem_cpy(num -> data, data, size);
+	if (data != NULL) {
+		mem_cpy(num -> data, data, size);
+		__chonky_trim(num, num -> size / 8);
+	}
 
 	return num;
 }
@@ -264,165 +735,124 @@ EXPORT_FUNCTION BigNum* alloc_chonky_num_from_data(u8* data, const u64 size, boo
     num -> is_freeable = is_freeable;
     num -> size = align_64(size);
     num -> data = data;
+    __chonky_trim(num, num -> size / 8);
 
     return num;
 }
 
-CHONKY_FAILABLE static BigNum* dup_chonky_num(const BigNum* num) {
+EXPORT_FUNCTION BigNum* dup_chonky_num(const BigNum* num) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
 	BigNum* duped = alloc_chonky_num(num -> data, num -> size, num -> sign);
 	return duped;
 }
 
 static u64 chonky_real_size(const BigNum* num) {
-	u64 size = num -> size;
-	for (s64 i = num -> size - 1; i >= 0; --i) {
-		if ((num -> data)[i]) break;
-		size--;
-	}
-	return size;
+	if (num -> limbs == 0) return 0;
+	return num -> limbs * 8 - __builtin_clzll((num -> data_64)[num -> limbs - 1]) / 8;
 }
 
-static u64 chonky_real_size_64(const BigNum* num) {
-	u64 size = num -> size / 8;
-	for (s64 i = (num -> size / 8) - 1; i >= 0; --i) {
-		if ((num -> data_64)[i]) break;
-		size--;
-	}
-	return size;
+static inline u64 chonky_real_size_64(const BigNum* num) {
+	return num -> limbs;
 }
 
 static u64 chonky_bit_size(const BigNum* num) {
-	u64 size = num -> size;
-	for (s64 i = num -> size - 1; i >= 0; --i) {
-		if ((num -> data)[i]) break;
-		size--;
-	}
+	if (num -> limbs == 0) return 0;
+	return num -> limbs * 64 - __builtin_clzll((num -> data_64)[num -> limbs - 1]);
+}
+
+static inline void __chonky_num_release(BigNum* num, void* ptr) {
+	__chonky_release(num -> is_pooled, ptr);
+	return;
+}
+
+// Moves the data between the inline limbs and the heap as the size crosses
+// the inline capacity.
+CHONKY_FAILABLE static void* __chonky_num_realloc(BigNum* num, u64 size) {
+	const bool fits_inline = (size <= sizeof(num -> inline_limbs));
+	if (IS_CHONKY_INLINE(num) && fits_inline) return num -> data;
 	
-	s8 bit_cnt = 0;
-	for (bit_cnt = 7; bit_cnt >= 0; --bit_cnt) {
-		if (GET_BIT((num -> data)[size - 1], bit_cnt)) break;
+	if (IS_CHONKY_INLINE(num)) {
+		// The pool of the number is the one holding the BigNum itself
+		u8* data = num -> is_pooled ? __chonky_pool_alloc((((ChonkyPoolBlock*) num) - 1) -> pool, size) : malloc(size);
+		if (data == NULL) return NULL;
+		mem_cpy(data, num -> data, MIN(size, num -> size));
+		return data;
+	} else if (fits_inline) {
+		mem_cpy(num -> inline_limbs, num -> data, MIN(size, num -> size));
+		__chonky_num_release(num, num -> data);
+		return num -> inline_limbs;
 	}
 	
-	size = size * 8 - (7 - bit_cnt);
-	
-	return size;
+	if (num -> is_pooled) return __chonky_pool_realloc(num -> data, size);
+	return realloc(num -> data, size);
 }
 
 CHONKY_FAILABLE static int chonky_resize(BigNum* num, u64 new_size) {
 	if (new_size == 0) new_size = align_64(chonky_real_size(num));
 	else new_size = align_64(new_size);
 
-	num -> data = (u8*) realloc(num -> data, new_size * sizeof(u8));
+	num -> data = (u8*) __chonky_num_realloc(num, new_size * sizeof(u8));
 	if (num -> data == NULL) {
 		WARNING_LOG("Failed to resize data buffer, from %llu to %llu.", num -> size, new_size);
-		free(num);
+		__chonky_num_release(num, num);
 		return -1;
 	}
 
 	num -> size = new_size;
+	__chonky_trim(num, MIN(num -> limbs, new_size / 8));
 	
 	return 0;
 }
 
-#define DEALLOC_CHONKY_NUMS(...) dealloc_chonky_nums((sizeof((BigNum*[]){__VA_ARGS__}) / sizeof(BigNum*)),  __VA_ARGS__)
-void dealloc_chonky_nums(int len, ...) {
-	va_list args;
-	va_start(args, len);
+// Grows the buffer of a caller owned number to at least `size` bytes, only
+// when needed, keeping its content and zeroing the new space.
+CHONKY_FAILABLE static BigNum* chonky_reserve(BigNum* num, u64 size) {
+	size = align_64(size);
+	if (num -> size >= size) return num;
+	
+	if (!num -> is_freeable) {
+		WARNING_LOG("The result is not freeable, and can not grow from %llu to %llu bytes.", num -> size, size);
+		return NULL;
+	}
 
-	for (int i = 0; i < len; ++i) {
-		BigNum* num = va_arg(args, BigNum*);
-		if (num -> is_freeable) free(num -> data);
-		num -> data = NULL;
-		free(num);
-    }
-    
-	va_end(args);
+	u8* data = (u8*) __chonky_num_realloc(num, size * sizeof(u8));
+	if (data == NULL) {
+		WARNING_LOG("Failed to grow data buffer, from %llu to %llu.", num -> size, size);
+		return NULL;
+	}
+
+	mem_set(data + num -> size, 0, size - num -> size);
+	num -> data = data;
+	num -> size = size;
 	
-	return;
+	return num;
 }
 
 EXPORT_FUNCTION void dealloc_chonky_num(BigNum* num) {
-	if (num -> is_freeable) free(num -> data);
+	if (num -> is_freeable && !IS_CHONKY_INLINE(num)) __chonky_num_release(num, num -> data);
 	num -> data = NULL;
-	free(num);
+	__chonky_num_release(num, num);
 	return;
 }
 
-static int chonky_shift_dec(BigNum* num, u64* temp) {
-	const u64 num_size = MIN(num -> size / 8, align_64(chonky_real_size(num)) / 8 + 1);
-
-	mem_cpy(temp, num -> data, num -> size);
-	mem_set(num -> data, 0, num -> size);
-
-	for (u64 i = 0; i < num_size; ++i) {
-		*((u128*) (num -> data_64 + i)) += ((u128) temp[i]) * 10;
-	}
-
-	return 0;
-}
+#define DEALLOC_CHONKY_NUMS(...) dealloc_chonky_nums((sizeof((BigNum*[]){__VA_ARGS__}) / sizeof(BigNum*)),  __VA_ARGS__)
+void dealloc_chonky_nums(int len, ...) {
+	va_list args;
+	va_start(args, len);
 
-static void chonky_add_decimal(BigNum* num, const u8 dec) {
-	u64 carry = _addcarry_u64(0, *(num -> data_64), dec, num -> data_64);
-	const u64 num_size = MIN(num -> size / 8, align_64(chonky_real_size(num)) / 8 + 1);
-	
-	for (u64 i = 1; carry && i < num_size; ++i) {
-		carry = _addcarry_u64(carry, (num -> data_64)[i], 0, num -> data_64 + i);
-	}
+	for (int i = 0; i < len; ++i) {
+		dealloc_chonky_num(va_arg(args, BigNum*));
+    }
+    
+	va_end(args);
 	
 	return;
 }
 
-#define IS_A_DEC_DIGIT(c) (((c) >= '0') && ((c) <= '9'))
-EXPORT_FUNCTION BigNum* alloc_chonky_num_from_string(const char* data_str) {
-	const u64 data_str_len = str_len(data_str);
-	if (data_str == NULL || data_str_len == 0) {
-		WARNING_LOG("Invalid parameters, string must not be empty or NULL pointer.");
-		return NULL;
-	}
-	
-	BigNum* num = calloc(1, sizeof(BigNum));
-	if (num == NULL) {
-		WARNING_LOG("Failed to allocate BigNum.");
-		return NULL;
-	}
-
-	num -> is_freeable = TRUE;
-	num -> sign = (data_str[0] == '-');
-	num -> size = align_64(data_str_len / 2 + 1);
-
-	num -> data = (u8*) calloc(num -> size, sizeof(u8));
-	if (num -> data == NULL) {
-		free(num);
-		WARNING_LOG("Failed to allocate data buffer.");
-		return NULL;
-	}
-	
-	u64* temp = calloc(num -> size, sizeof(u8));
-	if (temp == NULL) {
-		dealloc_chonky_num(num);
-		WARNING_LOG("Failed to allocate temp buffer.");
-		return NULL;
-	}
-	
-	for (u64 i = (*data_str == '-'); i < data_str_len; ++i) {
-		if (!IS_A_DEC_DIGIT(data_str[i])) {
-			SAFE_FREE(temp);
-			dealloc_chonky_num(num);
-			WARNING_LOG("'%c': is not a valid digit.", data_str[i]);
-			return NULL;
-		}
-		
-		chonky_shift_dec(num, temp);
-		chonky_add_decimal(num, data_str[i] - '0');
-	}
-
-	SAFE_FREE(temp);
-
-	if (chonky_resize(num, 0)) return NULL;
-
-	return num;
-}
-
 static inline u8 char_to_hex(char c) {
 	u8 val = 0;
 	if (c >= '0' && c <= '9')      val = c - '0';
@@ -439,28 +869,14 @@ EXPORT_FUNCTION BigNum* alloc_chonky_num_from_hex_string(const char* data_str) {
 		return NULL;
 	}
 	
-	BigNum* num = calloc(1, sizeof(BigNum));
-	if (num == NULL) {
-		WARNING_LOG("Failed to allocate BigNum.");
-		return NULL;
-	}
-
 	char* hex_str = (char*) data_str + (*data_str == '-');
 	u64 hex_str_len = str_len(hex_str);
 	
 	if (hex_str_len > 2 && *hex_str == '0' && hex_str[1] == 'x') hex_str += 2;
 	hex_str_len = str_len(hex_str);
 	
-	num -> is_freeable = TRUE;
-	num -> sign = (data_str[0] == '-');
-	num -> size = align_64((hex_str_len - (hex_str_len % 2)) / 2 + (hex_str_len % 2));
-
-	num -> data = (u8*) calloc(num -> size, sizeof(u8));
-	if (num -> data == NULL) {
-		free(num);
-		WARNING_LOG("Failed to allocate data buffer.");
-		return NULL;
-	}
+	BigNum* num = alloc_chonky_num(NULL, (hex_str_len - (hex_str_len % 2)) / 2 + (hex_str_len % 2), data_str[0] == '-');
+	if (num == NULL) return NULL;
 
 	for (s64 i = hex_str_len - 1, j = 0; i >= 0; i -= 2, ++j) {
 		if (!IS_A_HEX_DIGIT(hex_str[i])) {
@@ -478,6 +894,8 @@ EXPORT_FUNCTION BigNum* alloc_chonky_num_from_hex_string(const char* data_str) {
 		(num -> data)[j] = low | (high << 4);
 	}
 
+	__chonky_trim(num, num -> size / 8);
+
 	return num;
 }
 
@@ -490,39 +908,11 @@ static u64 __chonky_spow(u64 base, u64 exp) {
 	return result;
 }
 
-static BigNum* __chonky_rshift(BigNum* num, u64 bit_cnt) {
-	const u64 byte_cnt = (bit_cnt / 8) + !!(bit_cnt % 8);
-	if (byte_cnt > num -> size) {
-		mem_set(num -> data, 0, num -> size);
-		return num;
-	}
-	
-	const u64 base_byte_cnt = (bit_cnt / 8);
-	mem_cpy(num -> data, num -> data + base_byte_cnt, num -> size - base_byte_cnt);
-	mem_set(num -> data + num -> size - base_byte_cnt, 0, base_byte_cnt);
-
-	const u64 base_bits_rem = (bit_cnt % 8);
-	const u64 num_cur_size = num -> size - base_byte_cnt;
-	const u8 shift_mask = ((1 << base_bits_rem) - 1);
-
-	u8 prev_rem = 0;
-	for (s64 i = num_cur_size - 1; i >= 0; --i) {
-		u8 cur_rem = ((num -> data)[i] & shift_mask) << (8 - base_bits_rem);
-		(num -> data)[i] = prev_rem | ((num -> data)[i] >> base_bits_rem);
-		prev_rem = cur_rem;
-	}
-
-	return num;
-}
-
 static bool chonky_is_gt(const BigNum* a, const BigNum* b) {
-	u64 a_size = chonky_real_size(a);
-	u64 b_size = chonky_real_size(b);
-	
-	if (a_size > b_size) return TRUE;
-	else if (a_size < b_size) return FALSE;
+	if (a -> limbs > b -> limbs) return TRUE;
+	else if (a -> limbs < b -> limbs) return FALSE;
 
-	for (s64 i = (align_64(a_size) / 8) - 1; i >= 0; --i) {
+	for (s64 i = a -> limbs - 1; i >= 0; --i) {
 		if ((a -> data_64)[i] > (b -> data_64)[i]) return TRUE;
 		else if ((b -> data_64)[i] > (a -> data_64)[i]) return FALSE;
 	}
@@ -530,672 +920,5885 @@ static bool chonky_is_gt(const BigNum* a, const BigNum* b) {
 	return FALSE;
 }
 
-static bool is_chonky_zero(BigNum* num) {
-	for (u64 i = 0; i < num -> size / 8; ++i) {
-		if ((num -> data_64)[i]) return FALSE;
+static inline bool is_chonky_zero(const BigNum* num) {
+	return num -> limbs == 0;
+}
+
+/// -------------------------------
+///  Limb Level Kernels
+/// -------------------------------
+// NOTE: The following kernels work directly on little-endian arrays of u64
+// limbs, every length is expressed in limbs rather than bytes.
+
+// NOTE: Operands with fewer limbs than the threshold are multiplied with the
+// schoolbook basecase, both thresholds can be tuned at compile time.
+#ifndef CHONKY_KARATSUBA_THRESHOLD
+	#define CHONKY_KARATSUBA_THRESHOLD 32
+#endif //CHONKY_KARATSUBA_THRESHOLD
+
+#ifndef CHONKY_TOOM3_THRESHOLD
+	#define CHONKY_TOOM3_THRESHOLD 128
+#endif //CHONKY_TOOM3_THRESHOLD
+
+#ifndef CHONKY_SQR_KARATSUBA_THRESHOLD
+	#define CHONKY_SQR_KARATSUBA_THRESHOLD 48
+#endif //CHONKY_SQR_KARATSUBA_THRESHOLD
+
+#ifndef CHONKY_SQR_TOOM3_THRESHOLD
+	#define CHONKY_SQR_TOOM3_THRESHOLD 160
+#endif //CHONKY_SQR_TOOM3_THRESHOLD
+
+static inline void __chonky_limbs_zero(u64* rp, const u64 n) {
+	for (u64 i = 0; i < n; ++i) rp[i] = 0;
+	return;
+}
+
+static inline void __chonky_limbs_copy(u64* rp, const u64* ap, const u64 n) {
+	for (u64 i = 0; i < n; ++i) rp[i] = ap[i];
+	return;
+}
+
+// NOTE: Requires an >= bn, rp must have space for an limbs (it can alias ap or bp)
+static u64 __chonky_limbs_add(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	u64 carry = 0;
+	u64 i = 0;
+	for (; i < bn; ++i) carry = _addcarry_u64(carry, ap[i], bp[i], rp + i);
+	for (; i < an; ++i) carry = _addcarry_u64(carry, ap[i], 0, rp + i);
+	return carry;
+}
+
+// NOTE: Requires an >= bn, rp must have space for an limbs (it can alias ap or bp)
+static u64 __chonky_limbs_sub(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	u64 borrow = 0;
+	u64 i = 0;
+	for (; i < bn; ++i) borrow = _subborrow_u64(borrow, ap[i], bp[i], rp + i);
+	for (; i < an; ++i) borrow = _subborrow_u64(borrow, ap[i], 0, rp + i);
+	return borrow;
+}
+
+// In-place rp += ap, the carry stops propagating as soon as it is absorbed
+static u64 __chonky_limbs_add_in(u64* rp, const u64 rn, const u64* ap, const u64 an) {
+	u64 carry = 0;
+	u64 i = 0;
+	for (; i < an; ++i) carry = _addcarry_u64(carry, rp[i], ap[i], rp + i);
+	for (; carry && i < rn; ++i) carry = _addcarry_u64(carry, rp[i], 0, rp + i);
+	return carry;
+}
+
+// In-place rp -= ap, the borrow stops propagating as soon as it is absorbed
+static u64 __chonky_limbs_sub_in(u64* rp, const u64 rn, const u64* ap, const u64 an) {
+	u64 borrow = 0;
+	u64 i = 0;
+	for (; i < an; ++i) borrow = _subborrow_u64(borrow, rp[i], ap[i], rp + i);
+	for (; borrow && i < rn; ++i) borrow = _subborrow_u64(borrow, rp[i], 0, rp + i);
+	return borrow;
+}
+
+static int __chonky_limbs_cmp(const u64* ap, const u64* bp, const u64 n) {
+	for (s64 i = n - 1; i >= 0; --i) {
+		if (ap[i] != bp[i]) return ap[i] > bp[i] ? 1 : -1;
+	}
+	return 0;
+}
+
+// rp = ap * b, returns the carry limb
+static u64 __chonky_limbs_mul_1(u64* rp, const u64* ap, const u64 n, const u64 b) {
+	u64 carry = 0;
+	for (u64 i = 0; i < n; ++i) {
+		const u128 product = ((u128) ap[i]) * b + carry;
+		rp[i] = (u64) product;
+		carry = (u64) (product >> 64);
+	}
+	return carry;
+}
+
+// rp += ap * b, returns the carry limb
+static u64 __chonky_limbs_addmul_1(u64* rp, const u64* ap, const u64 n, const u64 b) {
+	u64 carry = 0;
+	for (u64 i = 0; i < n; ++i) {
+		const u128 product = ((u128) ap[i]) * b + rp[i] + carry;
+		rp[i] = (u64) product;
+		carry = (u64) (product >> 64);
+	}
+	return carry;
+}
+
+// NOTE: The division must be exact, the quotient overwrites the dividend
+static void __chonky_limbs_divexact_3(u64* rp, const u64 n) {
+	const u64 inv_3 = 0xAAAAAAAAAAAAAAABULL;
+	u64 borrow = 0;
+	for (u64 i = 0; i < n; ++i) {
+		const u64 limb = rp[i];
+		const u64 next_borrow = limb < borrow;
+		rp[i] = (limb - borrow) * inv_3;
+		borrow = (u64) ((((u128) rp[i]) * 3) >> 64) + next_borrow;
+	}
+	return;
+}
+
+static void __chonky_limbs_rshift_1(u64* rp, const u64 n) {
+	for (u64 i = 0; i + 1 < n; ++i) rp[i] = (rp[i] >> 1) | (rp[i + 1] << 63);
+	rp[n - 1] >>= 1;
+	return;
+}
+
+// rp -= ap * b, returns the borrow limb
+static u64 __chonky_limbs_submul_1(u64* rp, const u64* ap, const u64 n, const u64 b) {
+	u64 borrow = 0;
+	for (u64 i = 0; i < n; ++i) {
+		const u128 product = ((u128) ap[i]) * b + borrow;
+		borrow = (u64) (product >> 64) + _subborrow_u64(0, rp[i], (u64) product, rp + i);
+	}
+	return borrow;
+}
+
+// rp = ap << cnt, with cnt < 64, returns the bits shifted out (rp can alias ap)
+static u64 __chonky_limbs_lshift(u64* rp, const u64* ap, const u64 n, const u8 cnt) {
+	if (cnt == 0) {
+		if (rp != ap) __chonky_limbs_copy(rp, ap, n);
+		return 0;
+	}
+
+	const u64 out = ap[n - 1] >> (64 - cnt);
+	for (u64 i = n - 1; i > 0; --i) rp[i] = (ap[i] << cnt) | (ap[i - 1] >> (64 - cnt));
+	rp[0] = ap[0] << cnt;
+	return out;
+}
+
+// rp = ap >> cnt, with cnt < 64, returns the bits shifted out (rp can alias ap)
+static u64 __chonky_limbs_rshift(u64* rp, const u64* ap, const u64 n, const u8 cnt) {
+	if (cnt == 0) {
+		if (rp != ap) __chonky_limbs_copy(rp, ap, n);
+		return 0;
+	}
+
+	const u64 out = ap[0] << (64 - cnt);
+	for (u64 i = 0; i + 1 < n; ++i) rp[i] = (ap[i] >> cnt) | (ap[i + 1] << (64 - cnt));
+	rp[n - 1] = ap[n - 1] >> cnt;
+	return out;
+}
+
+// NOTE: The bitwise kernels are plain limb loops, left to the vectorizer, rp
+// can alias the operands
+static void __chonky_limbs_and(u64* rp, const u64* ap, const u64* bp, const u64 n) {
+	for (u64 i = 0; i < n; ++i) rp[i] = ap[i] & bp[i];
+	return;
+}
+
+static void __chonky_limbs_or(u64* rp, const u64* ap, const u64* bp, const u64 n) {
+	for (u64 i = 0; i < n; ++i) rp[i] = ap[i] | bp[i];
+	return;
+}
+
+static void __chonky_limbs_xor(u64* rp, const u64* ap, const u64* bp, const u64 n) {
+	for (u64 i = 0; i < n; ++i) rp[i] = ap[i] ^ bp[i];
+	return;
+}
+
+// -m^-1 mod 2^64 through Newton iteration, each step doubles the correct bits
+static u64 __chonky_mont_inverse(const u64 m0) {
+	u64 inv = m0;
+	for (u8 i = 0; i < 5; ++i) inv *= 2 - m0 * inv;
+	return -inv;
+}
+
+// Reciprocal of a normalized limb (top bit set), v = floor((B^2 - 1) / d) - B
+static inline u64 __chonky_limb_reciprocal(const u64 d) {
+	return (u64) (((((u128) ~d) << 64) | ~0ULL) / d);
+}
+
+// Divides <u1, u0> by the normalized limb d through its reciprocal v, as in
+// Moller-Granlund, so that the hardware division is never used.
+// NOTE: Requires u1 < d
+static inline u64 __chonky_limb_div_2by1(u64* r, const u64 u1, const u64 u0, const u64 d, const u64 v) {
+	const u128 q = ((u128) v) * u1 + ((((u128) u1) << 64) | u0);
+	u64 q1 = (u64) (q >> 64) + 1;
+	u64 rem = u0 - q1 * d;
+	
+	if (rem > (u64) q) {
+		q1--;
+		rem += d;
+	}
+	
+	if (rem >= d) {
+		q1++;
+		rem -= d;
+	}
+
+	*r = rem;
+	
+	return q1;
+}
+
+#define CHONKY_DIVREM_TEMP_SIZE(an, dn) ((an) + (dn) + 1)
+
+// Knuth Algorithm D, qp = ap / dp and rp = ap % dp, the divisor and the
+// dividend are normalized so that the top limb of the divisor has its high
+// bit set, then every quotient limb is estimated from the top two limbs of
+// the partial remainder and corrected with the second limb of the divisor,
+// which leaves at most one add-back per limb.
+// NOTE: Requires an >= dn and dp[dn - 1] != 0, qp needs an - dn + 1 limbs and
+// rp needs dn limbs, either can be NULL. The operands are copied in temp
+// (CHONKY_DIVREM_TEMP_SIZE(an, dn) limbs) so any aliasing is allowed.
+static void __chonky_limbs_divrem(u64* qp, u64* rp, const u64* ap, const u64 an, const u64* dp, const u64 dn, u64* temp) {
+	u64* up = temp;
+	u64* np = temp + an + 1;
+	const u8 shift = __builtin_clzll(dp[dn - 1]);
+	
+	__chonky_limbs_lshift(np, dp, dn, shift);
+	up[an] = __chonky_limbs_lshift(up, ap, an, shift);
+	
+	const u64 d1 = np[dn - 1];
+	const u64 v = __chonky_limb_reciprocal(d1);
+
+	if (dn == 1) {
+		u64 rem = up[an];
+		for (s64 j = an - 1; j >= 0; --j) {
+			const u64 q = __chonky_limb_div_2by1(&rem, rem, up[j], d1, v);
+			if (qp != NULL) qp[j] = q;
+		}
+		if (rp != NULL) rp[0] = rem >> shift;
+		return;
+	}
+
+	const u64 d0 = np[dn - 2];
+	for (s64 j = an - dn; j >= 0; --j) {
+		const u64 u2 = up[j + dn];
+		const u64 u1 = up[j + dn - 1];
+		const u64 u0 = up[j + dn - 2];
+
+		u64 q_hat = ~0ULL;
+		if (u2 < d1) {
+			u64 r_hat = 0;
+			q_hat = __chonky_limb_div_2by1(&r_hat, u2, u1, d1, v);
+			
+			// NOTE: Once r_hat overflows a limb the check can not fail anymore
+			while (((u128) q_hat) * d0 > ((((u128) r_hat) << 64) | u0)) {
+				q_hat--;
+				r_hat += d1;
+				if (r_hat < d1) break;
+			}
+		}
+
+		const u64 borrow = __chonky_limbs_submul_1(up + j, np, dn, q_hat);
+		bool is_negative = (up[j + dn] < borrow);
+		up[j + dn] -= borrow;
+		
+		while (is_negative) {
+			q_hat--;
+			is_negative = !__chonky_limbs_add_in(up + j, dn + 1, np, dn);
+		}
+
+		if (qp != NULL) qp[j] = q_hat;
+	}
+
+	if (rp != NULL) __chonky_limbs_rshift(rp, up, dn, shift);
+
+	return;
+}
+
+// NOTE: On CPUs with AVX-512 IFMA the basecase and the Montgomery
+// multiplications run over radix 2^52 digits, through the 52x52 bits
+// multiply-add instructions (vpmadd52luq/vpmadd52huq), 8 digits at once.
+// The operands are converted on the way in and out, so that everything else
+// keeps working on u64 limbs, while the scalar kernels remain the fallback.
+// The carries are accumulated in the upper 12 bits of each digit and only
+// propagated at the end, or every CHONKY_IFMA_CARRY_ROWS rows.
+#ifndef CHONKY_USE_IFMA
+	#define CHONKY_USE_IFMA TRUE
+#endif //CHONKY_USE_IFMA
+
+// Minimum operand size, in limbs, for which the IFMA kernels are picked,
+// below them the cost of the conversions outweighs the gain
+#ifndef CHONKY_IFMA_THRESHOLD
+	#define CHONKY_IFMA_THRESHOLD 16
+#endif //CHONKY_IFMA_THRESHOLD
+
+#ifndef CHONKY_IFMA_MONT_THRESHOLD
+	#define CHONKY_IFMA_MONT_THRESHOLD 8
+#endif //CHONKY_IFMA_MONT_THRESHOLD
+
+#define CHONKY_IFMA_DIGIT_BITS 52ULL
+#define CHONKY_IFMA_DIGIT_MASK ((1ULL << CHONKY_IFMA_DIGIT_BITS) - 1)
+#define CHONKY_IFMA_CARRY_ROWS 256
+#define CHONKY_IFMA_MAX_ROWS   2048
+// Digits needed by n limbs, and the same count rounded up to whole vectors
+#define CHONKY_IFMA_DIGITS(n)        (((n) * 64 + CHONKY_IFMA_DIGIT_BITS - 1) / CHONKY_IFMA_DIGIT_BITS)
+#define CHONKY_IFMA_PADDED_DIGITS(n) ((CHONKY_IFMA_DIGITS(n) + 7) & ~7ULL)
+#define CHONKY_IFMA_MONT_TEMP_SIZE(n) (3 * CHONKY_IFMA_PADDED_DIGITS(n) + (n) + 1)
+
+// Splits the n limbs of ap in d digits, the digits past the number are zeroed
+static void __chonky_ifma_from_limbs(u64* rp, const u64 d, const u64* ap, const u64 n) {
+	for (u64 i = 0; i < d; ++i) {
+		const u64 bit = i * CHONKY_IFMA_DIGIT_BITS;
+		const u64 limb = bit / 64;
+		const u8 shift = bit % 64;
+		
+		u64 digit = (limb < n) ? ap[limb] >> shift : 0;
+		if (shift > 64 - CHONKY_IFMA_DIGIT_BITS && limb + 1 < n) digit |= ap[limb + 1] << (64 - shift);
+		rp[i] = digit & CHONKY_IFMA_DIGIT_MASK;
+	}
+	return;
+}
+
+// Packs d normalized digits back into n limbs, the value must fit them
+static void __chonky_ifma_to_limbs(u64* rp, const u64 n, const u64* ap, const u64 d) {
+	__chonky_limbs_zero(rp, n);
+	for (u64 i = 0; i < d; ++i) {
+		const u64 bit = i * CHONKY_IFMA_DIGIT_BITS;
+		const u64 limb = bit / 64;
+		const u8 shift = bit % 64;
+		
+		if (limb < n) rp[limb] |= ap[i] << shift;
+		if (shift > 64 - CHONKY_IFMA_DIGIT_BITS && limb + 1 < n) rp[limb + 1] |= ap[i] >> (64 - shift);
+	}
+	return;
+}
+
+// Propagates the carries of d digits, returns the carry out of the last one
+static u64 __chonky_ifma_carry(u64* rp, const u64 d) {
+	u64 carry = 0;
+	for (u64 i = 0; i < d; ++i) {
+		const u64 digit = rp[i] + carry;
+		carry = digit >> CHONKY_IFMA_DIGIT_BITS;
+		rp[i] = digit & CHONKY_IFMA_DIGIT_MASK;
+	}
+	return carry;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+static inline bool __chonky_has_ifma(void) {
+	__builtin_cpu_init();
+	return CHONKY_USE_IFMA && __builtin_cpu_supports("avx512ifma");
+}
+
+// rp = ap * bp, rp must have space for an + bn limbs, and must not overlap the operands.
+// Each block of 8 result digits is accumulated in registers over every row
+// that reaches it, with the digits of a loaded from the matching shifted
+// window, zero padded at both ends. The low halves of the products are kept
+// apart from the high halves, which belong one digit up.
+// NOTE: Returns NULL when the kernel can not be used (out of memory, or more
+// rows than the accumulators can hold), leaving the work to the basecase
+__attribute__((target("avx512f,avx512ifma"))) static u64* __chonky_mul_ifma(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	const u64 da = CHONKY_IFMA_DIGITS(an);
+	const u64 db = CHONKY_IFMA_DIGITS(bn);
+	const u64 dr = (da + db + 7) & ~7ULL;
+	if (db > CHONKY_IFMA_MAX_ROWS) return NULL;
+
+	u64* temp = __chonky_calloc(8 + db + 3 * dr, sizeof(u64));
+	if (temp == NULL) return NULL;
+	
+	u64* a_digits = temp + 8;
+	u64* b_digits = a_digits + dr;
+	u64* lo = b_digits + db;
+	u64* hi = lo + dr;
+	__chonky_ifma_from_limbs(a_digits, da, ap, an);
+	__chonky_ifma_from_limbs(b_digits, db, bp, bn);
+
+	for (u64 k = 0; k < dr; k += 8) {
+		__m512i lo_acc = _mm512_setzero_si512();
+		__m512i hi_acc = _mm512_setzero_si512();
+		const u64 last = MIN(db, k + 8);
+		for (u64 i = (k + 1 > da) ? k + 1 - da : 0; i < last; ++i) {
+			const __m512i av = _mm512_loadu_si512(a_digits + k - i);
+			const __m512i bv = _mm512_set1_epi64(b_digits[i]);
+			lo_acc = _mm512_madd52lo_epu64(lo_acc, av, bv);
+			hi_acc = _mm512_madd52hi_epu64(hi_acc, av, bv);
+		}
+		_mm512_storeu_si512(lo + k, lo_acc);
+		_mm512_storeu_si512(hi + k, hi_acc);
+	}
+
+	u64 carry = 0;
+	for (u64 k = 0; k < dr; ++k) {
+		const u64 digit = lo[k] + carry;
+		carry = (digit >> CHONKY_IFMA_DIGIT_BITS) + hi[k];
+		lo[k] = digit & CHONKY_IFMA_DIGIT_MASK;
+	}
+	__chonky_ifma_to_limbs(rp, an + bn, lo, dr);
+
+	__chonky_free(temp);
+
+	return rp;
+}
+
+// CIOS Montgomery multiplication over d digits, rp = ap * bp * 2^(-52 * d) mod m,
+// with rp of dp + 1 normalized digits, dp being d rounded up to whole vectors.
+// Each row drops the lowest digit while storing the accumulator back, by
+// aligning every vector with the next one, so that the high halves of the
+// products can be added in place, at their weight.
+// NOTE: temp must have space for dp digits, the result is below 2m
+__attribute__((target("avx512f,avx512ifma"))) static void __chonky_mont_mul_ifma(u64* rp, const u64* ap, const u64* bp, const u64* mp, const u64 m_inv, const u64 d, u64* temp) {
+	const u64 dp = (d + 7) & ~7ULL;
+	const __m512i zero = _mm512_setzero_si512();
+	u64* tp = temp;
+	__chonky_limbs_zero(tp, dp);
+
+	for (u64 i = 0; i < d; ++i) {
+		const __m512i bv = _mm512_set1_epi64(bp[i]);
+		__m512i av = _mm512_loadu_si512(ap);
+		__m512i mv = _mm512_loadu_si512(mp);
+		__m512i t = _mm512_madd52lo_epu64(_mm512_loadu_si512(tp), av, bv);
+		
+		const u64 t0 = _mm_cvtsi128_si64(_mm512_castsi512_si128(t));
+		const __m512i qv = _mm512_set1_epi64(((t0 & CHONKY_IFMA_DIGIT_MASK) * m_inv) & CHONKY_IFMA_DIGIT_MASK);
+		t = _mm512_madd52lo_epu64(t, mv, qv);
+		__m512i h = _mm512_madd52hi_epu64(_mm512_madd52hi_epu64(zero, av, bv), mv, qv);
+		
+		// The lowest digit is now a multiple of 2^52, only its carry survives the shift
+		__m512i carry = _mm512_maskz_srli_epi64(1, t, CHONKY_IFMA_DIGIT_BITS);
+		for (u64 j = 8; j < dp; j += 8) {
+			av = _mm512_loadu_si512(ap + j);
+			mv = _mm512_loadu_si512(mp + j);
+			const __m512i t_next = _mm512_madd52lo_epu64(_mm512_madd52lo_epu64(_mm512_loadu_si512(tp + j), av, bv), mv, qv);
+			_mm512_storeu_si512(tp + j - 8, _mm512_add_epi64(_mm512_add_epi64(_mm512_alignr_epi64(t_next, t, 1), h), carry));
+			h = _mm512_madd52hi_epu64(_mm512_madd52hi_epu64(zero, av, bv), mv, qv);
+			t = t_next;
+			carry = zero;
+		}
+		_mm512_storeu_si512(tp + dp - 8, _mm512_add_epi64(_mm512_add_epi64(_mm512_alignr_epi64(zero, t, 1), h), carry));
+
+		if ((i + 1) % CHONKY_IFMA_CARRY_ROWS == 0) {
+			const u64 top = __chonky_ifma_carry(tp, dp);
+			tp[dp - 1] += top << CHONKY_IFMA_DIGIT_BITS;
+		}
+	}
+
+	rp[dp] = __chonky_ifma_carry(tp, dp);
+	__chonky_limbs_copy(rp, tp, dp);
+
+	return;
+}
+
+#else
+
+static inline bool __chonky_has_ifma(void) {
+	return FALSE;
+}
+
+static u64* __chonky_mul_ifma(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	(void) rp, (void) ap, (void) an, (void) bp, (void) bn;
+	return NULL;
+}
+
+static void __chonky_mont_mul_ifma(u64* rp, const u64* ap, const u64* bp, const u64* mp, const u64 m_inv, const u64 d, u64* temp) {
+	(void) rp, (void) ap, (void) bp, (void) mp, (void) m_inv, (void) d, (void) temp;
+	return;
+}
+
+#endif //defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+// NOTE: rp must have space for an + bn limbs, and must not overlap the operands
+static void __chonky_mul_basecase(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	rp[an] = __chonky_limbs_mul_1(rp, ap, an, bp[0]);
+	for (u64 j = 1; j < bn; ++j) {
+		rp[an + j] = __chonky_limbs_addmul_1(rp + j, ap, an, bp[j]);
+	}
+	return;
+}
+
+CHONKY_FAILABLE static u64* __chonky_limbs_mul(u64* rp, const u64* ap, u64 an, const u64* bp, u64 bn);
+CHONKY_FAILABLE static u64* __chonky_limbs_sqr(u64* rp, const u64* ap, const u64 n);
+
+// A subproduct of the recursive kernels, rp = ap * bp, or ap^2 when bp is NULL
+typedef struct ChonkyProduct {
+	u64* rp;
+	const u64* ap;
+	u64 an;
+	const u64* bp;
+	u64 bn;
+} ChonkyProduct;
+
+static bool __chonky_product_run(void* arg) {
+	const ChonkyProduct* prod = (const ChonkyProduct*) arg;
+	if (prod -> bp == NULL) return __chonky_limbs_sqr(prod -> rp, prod -> ap, prod -> an) != NULL;
+	return __chonky_limbs_mul(prod -> rp, prod -> ap, prod -> an, prod -> bp, prod -> bn) != NULL;
+}
+
+// Computes the independent subproducts of an operation over size limbs,
+// across the workers when it is big enough.
+// NOTE: Returns FALSE when any of them failed
+static bool __chonky_products_run(ChonkyProduct* products, const u64 count, const u64 size) {
+	ChonkyTask tasks[5] = { 0 };
+	CHONKY_ASSERT(count <= ARR_SIZE(tasks));
+	for (u64 i = 0; i < count; ++i) tasks[i] = (ChonkyTask) { .run = __chonky_product_run, .arg = products + i };
+	return __chonky_tasks_run(tasks, count, size);
+}
+
+// Split both operands in halves at h limbs, so that only three products are
+// required: a0 * b0, a1 * b1 and (a0 + a1) * (b0 + b1).
+// NOTE: Requires an >= bn > ceil(an / 2)
+CHONKY_FAILABLE static u64* __chonky_mul_karatsuba(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	const u64 h = (an + 1) / 2;
+	const u64 a1_size = an - h;
+	const u64 b1_size = bn - h;
+	const u64 mid_size = 2 * h + 2;
+
+	u64* temp = __chonky_calloc(2 * (h + 1) + mid_size, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate karatsuba temp buffer.");
+		return NULL;
+	}
+
+	u64* sum_a = temp;
+	u64* sum_b = temp + h + 1;
+	u64* mid = temp + 2 * (h + 1);
+
+	sum_a[h] = __chonky_limbs_add(sum_a, ap, h, ap + h, a1_size);
+	sum_b[h] = __chonky_limbs_add(sum_b, bp, h, bp + h, b1_size);
+
+	ChonkyProduct products[] = {
+		{ .rp = mid, .ap = sum_a, .an = h + 1, .bp = sum_b, .bn = h + 1 },
+		{ .rp = rp, .ap = ap, .an = h, .bp = bp, .bn = h },
+		{ .rp = rp + 2 * h, .ap = ap + h, .an = a1_size, .bp = bp + h, .bn = b1_size }
+	};
+
+	if (!__chonky_products_run(products, ARR_SIZE(products), bn)) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	__chonky_limbs_sub_in(mid, mid_size, rp, 2 * h);
+	__chonky_limbs_sub_in(mid, mid_size, rp + 2 * h, a1_size + b1_size);
+	__chonky_limbs_add_in(rp + h, an + bn - h, mid, MIN(mid_size, an + bn - h));
+
+	__chonky_free(temp);
+
+	return rp;
+}
+
+// Evaluates x = x0 + x1 * B^k + x2 * B^2k at 1, |-1| and 2, each evaluation
+// takes k + 1 limbs, returns TRUE when x(-1) is negative.
+static bool __chonky_toom3_eval(u64* eval[3], const u64* xp, const u64 k, const u64 x2_size) {
+	const u64* x0 = xp;
+	const u64* x1 = xp + k;
+	const u64* x2 = xp + 2 * k;
+	bool sign = FALSE;
+
+	// eval[0] = x0 + x2 + x1, eval[1] = |x0 + x2 - x1|
+	eval[1][k] = __chonky_limbs_add(eval[1], x0, k, x2, x2_size);
+	eval[0][k] = eval[1][k] + __chonky_limbs_add(eval[0], eval[1], k, x1, k);
+	if (eval[1][k] == 0 && __chonky_limbs_cmp(eval[1], x1, k) < 0) {
+		__chonky_limbs_sub(eval[1], x1, k, eval[1], k);
+		sign = TRUE;
+	} else {
+		eval[1][k] -= __chonky_limbs_sub(eval[1], eval[1], k, x1, k);
+	}
+
+	// eval[2] = x0 + 2 * x1 + 4 * x2
+	__chonky_limbs_copy(eval[2], x0, k);
+	eval[2][k] = __chonky_limbs_addmul_1(eval[2], x1, k, 2);
+	const u64 carry = __chonky_limbs_addmul_1(eval[2], x2, x2_size, 4);
+	__chonky_limbs_add_in(eval[2] + x2_size, k + 1 - x2_size, &carry, 1);
+
+	return sign;
+}
+
+// Interpolates the five point-wise products back into rp (Bodrato's sequence),
+// v0 and vinf are expected to be already stored in rp[0, 2k) and rp[4k, total).
+// NOTE: The intermediate values are kept in two's complement over 2k + 2
+// limbs, as only v(-1) can be negative while every coefficient is not.
+static void __chonky_toom3_interpolate(u64* rp, const u64 k, const u64 total, u64* v1, u64* vm1, const bool vm1_sign, u64* v2) {
+	const u64 len = 2 * k + 2;
+	const u64 inf_size = total - 4 * k;
+	const u64* v0 = rp;
+	const u64* vinf = rp + 4 * k;
+
+	__chonky_limbs_zero(rp + 2 * k, 2 * k);
+
+	if (vm1_sign) {
+		for (u64 i = 0; i < len; ++i) vm1[i] = ~vm1[i];
+		const u64 one = 1;
+		__chonky_limbs_add_in(vm1, len, &one, 1);
+	}
+
+	// v2 = (v2 - vm1) / 3 = r1 + r2 + 3r3 + 5r4
+	__chonky_limbs_sub(v2, v2, len, vm1, len);
+	__chonky_limbs_divexact_3(v2, len);
+
+	// vm1 = (v1 - vm1) / 2 = r1 + r3
+	__chonky_limbs_sub(vm1, v1, len, vm1, len);
+	__chonky_limbs_rshift_1(vm1, len);
+
+	// v1 = v1 - v0 = r1 + r2 + r3 + r4
+	__chonky_limbs_sub_in(v1, len, v0, 2 * k);
+
+	// v2 = (v2 - v1) / 2 - 2 * vinf = r3
+	__chonky_limbs_sub(v2, v2, len, v1, len);
+	__chonky_limbs_rshift_1(v2, len);
+	__chonky_limbs_sub_in(v2, len, vinf, inf_size);
+	__chonky_limbs_sub_in(v2, len, vinf, inf_size);
+
+	// v1 = v1 - vm1 - vinf = r2
+	__chonky_limbs_sub(v1, v1, len, vm1, len);
+	__chonky_limbs_sub_in(v1, len, vinf, inf_size);
+
+	// vm1 = vm1 - v2 = r1
+	__chonky_limbs_sub(vm1, vm1, len, v2, len);
+
+	__chonky_limbs_add_in(rp + k, total - k, vm1, MIN(len, total - k));
+	__chonky_limbs_add_in(rp + 2 * k, total - 2 * k, v1, MIN(len, total - 2 * k));
+	__chonky_limbs_add_in(rp + 3 * k, total - 3 * k, v2, MIN(len, total - 3 * k));
+
+	return;
+}
+
+// Split both operands in thirds of k limbs, evaluate at 0, 1, -1, 2 and
+// infinity, and then interpolate back the five point-wise products.
+// NOTE: Requires an >= bn > 2 * ceil(an / 3)
+CHONKY_FAILABLE static u64* __chonky_mul_toom3(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	const u64 k = (an + 2) / 3;
+	const u64 a2_size = an - 2 * k;
+	const u64 b2_size = bn - 2 * k;
+	const u64 len = 2 * k + 2;
+
+	u64* temp = __chonky_calloc(6 * (k + 1) + 3 * len, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate toom3 temp buffer.");
+		return NULL;
+	}
+
+	u64* eval_a[3] = { temp, temp + (k + 1), temp + 2 * (k + 1) };
+	u64* eval_b[3] = { temp + 3 * (k + 1), temp + 4 * (k + 1), temp + 5 * (k + 1) };
+	u64* v1 = temp + 6 * (k + 1);
+	u64* vm1 = v1 + len;
+	u64* v2 = vm1 + len;
+
+	bool vm1_sign = __chonky_toom3_eval(eval_a, ap, k, a2_size);
+	vm1_sign ^= __chonky_toom3_eval(eval_b, bp, k, b2_size);
+
+	ChonkyProduct products[] = {
+		{ .rp = v1, .ap = eval_a[0], .an = k + 1, .bp = eval_b[0], .bn = k + 1 },
+		{ .rp = vm1, .ap = eval_a[1], .an = k + 1, .bp = eval_b[1], .bn = k + 1 },
+		{ .rp = v2, .ap = eval_a[2], .an = k + 1, .bp = eval_b[2], .bn = k + 1 },
+		{ .rp = rp, .ap = ap, .an = k, .bp = bp, .bn = k },
+		{ .rp = rp + 4 * k, .ap = ap + 2 * k, .an = a2_size, .bp = bp + 2 * k, .bn = b2_size }
+	};
+
+	if (!__chonky_products_run(products, ARR_SIZE(products), bn)) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	__chonky_toom3_interpolate(rp, k, an + bn, v1, vm1, vm1_sign, v2);
+
+	__chonky_free(temp);
+
+	return rp;
+}
+
+// NOTE: When the operands are too unbalanced, the bigger one is sliced in
+// chunks as big as the smaller one, so that the balanced kernels still apply.
+CHONKY_FAILABLE static u64* __chonky_mul_unbalanced(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	u64* temp = __chonky_calloc(2 * bn, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate unbalanced mul temp buffer.");
+		return NULL;
+	}
+
+	__chonky_limbs_zero(rp, an + bn);
+
+	for (u64 i = 0; i < an; i += bn) {
+		const u64 chunk_size = MIN(bn, an - i);
+		if (__chonky_limbs_mul(temp, ap + i, chunk_size, bp, bn) == NULL) {
+			__chonky_free(temp);
+			return NULL;
+		}
+		__chonky_limbs_add_in(rp + i, an + bn - i, temp, chunk_size + bn);
+	}
+
+	__chonky_free(temp);
+
+	return rp;
+}
+
+// NOTE: Past CHONKY_NTT_THRESHOLD limbs the products go through number
+// theoretic transforms modulo three primes p = c * 2^s + 1 right below 2^62,
+// taking every limb as a coefficient. The coefficients of the product are
+// below len * 2^128, far from p1 * p2 * p3 (about 2^185), so that they are
+// rebuilt exactly through the CRT (Garner). The three transforms are
+// independent and run as a task group. Residues stay in normal form, while
+// twiddles and constants are kept in Montgomery form (x * 2^64 mod p), so
+// that a Montgomery multiplication by them is a plain modular one.
+#ifndef CHONKY_NTT_THRESHOLD
+	#define CHONKY_NTT_THRESHOLD 4096
+#endif //CHONKY_NTT_THRESHOLD
+
+#ifndef CHONKY_SQR_NTT_THRESHOLD
+	#define CHONKY_SQR_NTT_THRESHOLD 3072
+#endif //CHONKY_SQR_NTT_THRESHOLD
+
+typedef struct ChonkyNttPrime {
+	u64 p;
+	u64 g;
+} ChonkyNttPrime;
+
+// Primes with their primitive roots, the smallest 2-adic order is 52
+static const ChonkyNttPrime __chonky_ntt_primes[] = {
+	{ .p = 0x3A00000000000001ULL, .g = 3 },
+	{ .p = 0x3EA0000000000001ULL, .g = 7 },
+	{ .p = 0x3E10000000000001ULL, .g = 7 }
+};
+
+#define CHONKY_NTT_PRIMES ARR_SIZE(__chonky_ntt_primes)
+
+// a * b * 2^-64 mod p, with p_inv = -p^-1 mod 2^64
+static inline u64 __chonky_ntt_mul(const u64 a, const u64 b, const u64 p, const u64 p_inv) {
+	const u128 t = ((u128) a) * b;
+	const u64 m = ((u64) t) * p_inv;
+	const u64 u = (u64) ((t + ((u128) m) * p) >> 64);
+	return (u >= p) ? u - p : u;
+}
+
+static inline u64 __chonky_ntt_add(const u64 a, const u64 b, const u64 p) {
+	const u64 sum = a + b;
+	return (sum >= p) ? sum - p : sum;
+}
+
+static inline u64 __chonky_ntt_sub(const u64 a, const u64 b, const u64 p) {
+	return (a >= b) ? a - b : a + p - b;
+}
+
+// Montgomery form constants of a prime, with r = 2^64 mod p and r2 = 2^128 mod p
+typedef struct ChonkyNttMod {
+	u64 p;
+	u64 p_inv;
+	u64 r;
+	u64 r2;
+} ChonkyNttMod;
+
+static ChonkyNttMod __chonky_ntt_mod(const u64 p) {
+	const u64 r = (u64) ((((u128) 1) << 64) % p);
+	return (ChonkyNttMod) { .p = p, .p_inv = __chonky_mont_inverse(p), .r = r, .r2 = (u64) ((((u128) r) * r) % p) };
+}
+
+// base^exp in Montgomery form, with the base in Montgomery form as well
+static u64 __chonky_ntt_pow(const ChonkyNttMod* mod, u64 base, u64 exp) {
+	u64 res = mod -> r;
+	for (; exp; exp >>= 1) {
+		if (exp & 1) res = __chonky_ntt_mul(res, base, mod -> p, mod -> p_inv);
+		base = __chonky_ntt_mul(base, base, mod -> p, mod -> p_inv);
+	}
+	return res;
+}
+
+// Decimation in frequency, from natural order to bit reversed order, with
+// roots[j] = w^j for j < len / 2
+static void __chonky_ntt_forward(u64* ap, const u64 len, const u64* roots, const ChonkyNttMod* mod) {
+	const u64 p = mod -> p;
+	for (u64 m = len / 2, stride = 1; m >= 1; m /= 2, stride *= 2) {
+		for (u64 start = 0; start < len; start += 2 * m) {
+			u64* lo = ap + start;
+			u64* hi = lo + m;
+			for (u64 j = 0; j < m; ++j) {
+				const u64 u = lo[j];
+				const u64 v = hi[j];
+				lo[j] = __chonky_ntt_add(u, v, p);
+				hi[j] = __chonky_ntt_mul(__chonky_ntt_sub(u, v, p), roots[j * stride], p, mod -> p_inv);
+			}
+		}
+	}
+	return;
+}
+
+// Decimation in time with the inverse roots, from bit reversed order back to
+// natural order, the result is still to be divided by len.
+// NOTE: w^-j = -w^(len / 2 - j), so that the same table is reused
+static void __chonky_ntt_inverse(u64* ap, const u64 len, const u64* roots, const ChonkyNttMod* mod) {
+	const u64 p = mod -> p;
+	for (u64 m = 1, stride = len / 2; m < len; m *= 2, stride /= 2) {
+		for (u64 start = 0; start < len; start += 2 * m) {
+			u64* lo = ap + start;
+			u64* hi = lo + m;
+			for (u64 j = 0; j < m; ++j) {
+				const u64 u = lo[j];
+				const u64 v = (j == 0) ? hi[j] : __chonky_ntt_mul(hi[j], p - roots[len / 2 - j * stride], p, mod -> p_inv);
+				lo[j] = __chonky_ntt_add(u, v, p);
+				hi[j] = __chonky_ntt_sub(u, v, p);
+			}
+		}
+	}
+	return;
+}
+
+// The convolution modulo one of the primes, rp = ap * bp mod p over len
+// coefficients, or ap^2 when bp is NULL, temp must have space for len limbs.
+typedef struct ChonkyNttTask {
+	u64* rp;
+	const u64* ap;
+	u64 an;
+	const u64* bp;
+	u64 bn;
+	u64* temp;
+	u64 len;
+	u64 prime;
+} ChonkyNttTask;
+
+static bool __chonky_ntt_run(void* arg) {
+	const ChonkyNttTask* task = (const ChonkyNttTask*) arg;
+	const ChonkyNttPrime* prime = __chonky_ntt_primes + task -> prime;
+	const ChonkyNttMod mod = __chonky_ntt_mod(prime -> p);
+	const u64 p = mod.p;
+	const u64 len = task -> len;
+
+	u64* roots = __chonky_calloc(len / 2, sizeof(u64));
+	if (roots == NULL) {
+		WARNING_LOG("Failed to allocate ntt roots.");
+		return FALSE;
+	}
+
+	const u64 w = __chonky_ntt_pow(&mod, __chonky_ntt_mul(prime -> g, mod.r2, p, mod.p_inv), (p - 1) / len);
+	roots[0] = mod.r;
+	for (u64 j = 1; j < len / 2; ++j) roots[j] = __chonky_ntt_mul(roots[j - 1], w, p, mod.p_inv);
+
+	// Limbs are loaded in Montgomery form, which also reduces them below p
+	u64* rp = task -> rp;
+	for (u64 i = 0; i < len; ++i) rp[i] = (i < task -> an) ? __chonky_ntt_mul((task -> ap)[i], mod.r2, p, mod.p_inv) : 0;
+	__chonky_ntt_forward(rp, len, roots, &mod);
+	
+	if (task -> bp != NULL) {
+		u64* tp = task -> temp;
+		for (u64 i = 0; i < len; ++i) tp[i] = (i < task -> bn) ? __chonky_ntt_mul((task -> bp)[i], mod.r2, p, mod.p_inv) : 0;
+		__chonky_ntt_forward(tp, len, roots, &mod);
+		for (u64 i = 0; i < len; ++i) rp[i] = __chonky_ntt_mul(rp[i], tp[i], p, mod.p_inv);
+	} else {
+		for (u64 i = 0; i < len; ++i) rp[i] = __chonky_ntt_mul(rp[i], rp[i], p, mod.p_inv);
+	}
+	
+	__chonky_ntt_inverse(rp, len, roots, &mod);
+
+	// Both the factor len and the 2^64 left by the pointwise products go away
+	// with a Montgomery multiplication by len^-1 = -(p - 1) / len
+	const u64 scale = p - (p - 1) / len;
+	for (u64 i = 0; i < len; ++i) rp[i] = __chonky_ntt_mul(rp[i], scale, p, mod.p_inv);
+
+	__chonky_free(roots);
+
+	return TRUE;
+}
+
+// rp = ap * bp through the transforms, or ap^2 when bp is NULL (with bn = an),
+// so that a single forward transform is needed per prime.
+// NOTE: rp must have space for an + bn limbs, and must not overlap the operands
+CHONKY_FAILABLE static u64* __chonky_mul_ntt(u64* rp, const u64* ap, const u64 an, const u64* bp, const u64 bn) {
+	u64 len = 2;
+	while (len < an + bn - 1) len <<= 1;
+
+	u64* temp = __chonky_calloc(((bp != NULL) ? 2 : 1) * CHONKY_NTT_PRIMES * len, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate ntt buffers.");
+		return NULL;
+	}
+
+	ChonkyNttTask ntt_tasks[CHONKY_NTT_PRIMES] = { 0 };
+	ChonkyTask tasks[CHONKY_NTT_PRIMES] = { 0 };
+	for (u64 k = 0; k < CHONKY_NTT_PRIMES; ++k) {
+		ntt_tasks[k] = (ChonkyNttTask) {
+			.rp = temp + k * len, .ap = ap, .an = an, .bp = bp, .bn = bn,
+			.temp = (bp != NULL) ? temp + (CHONKY_NTT_PRIMES + k) * len : NULL, .len = len, .prime = k
+		};
+		tasks[k] = (ChonkyTask) { .run = __chonky_ntt_run, .arg = ntt_tasks + k };
+	}
+
+	if (!__chonky_tasks_run(tasks, CHONKY_NTT_PRIMES, MIN(an, bn))) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	// Garner, x = v1 + v2 * p1 + v3 * p1 * p2, with every v below its prime
+	const ChonkyNttMod mod_2 = __chonky_ntt_mod(__chonky_ntt_primes[1].p);
+	const ChonkyNttMod mod_3 = __chonky_ntt_mod(__chonky_ntt_primes[2].p);
+	const u64 p1 = __chonky_ntt_primes[0].p;
+	const u64 p2 = mod_2.p;
+	const u64 p3 = mod_3.p;
+	const u128 p1_p2 = ((u128) p1) * p2;
+
+	// p^-1 = p^(q - 2) mod q, all of them in Montgomery form
+	const u64 p1_mod_3 = __chonky_ntt_mul(p1 % p3, mod_3.r2, p3, mod_3.p_inv);
+	const u64 p1_inv_2 = __chonky_ntt_pow(&mod_2, __chonky_ntt_mul(p1 % p2, mod_2.r2, p2, mod_2.p_inv), p2 - 2);
+	const u64 p1_p2_inv_3 = __chonky_ntt_pow(&mod_3, __chonky_ntt_mul((u64) (p1_p2 % p3), mod_3.r2, p3, mod_3.p_inv), p3 - 2);
+
+	u64 acc[4] = { 0 };
+	for (u64 i = 0; i < an + bn; ++i) {
+		if (i < an + bn - 1) {
+			const u64 v1 = temp[i];
+			const u64 v2 = __chonky_ntt_mul(__chonky_ntt_sub(temp[len + i], (v1 >= p2) ? v1 - p2 : v1, p2), p1_inv_2, p2, mod_2.p_inv);
+			const u64 v12_3 = __chonky_ntt_add((v1 >= p3) ? v1 - p3 : v1, __chonky_ntt_mul(v2, p1_mod_3, p3, mod_3.p_inv), p3);
+			const u64 v3 = __chonky_ntt_mul(__chonky_ntt_sub(temp[2 * len + i], v12_3, p3), p1_p2_inv_3, p3, mod_3.p_inv);
+
+			const u128 low = ((u128) v2) * p1 + v1;
+			const u128 high_lo = ((u128) v3) * ((u64) p1_p2);
+			const u128 high_hi = ((u128) v3) * ((u64) (p1_p2 >> 64));
+			const u64 low_x[2] = { (u64) low, (u64) (low >> 64) };
+			const u64 high_x[2] = { (u64) high_lo, (u64) (high_lo >> 64) };
+			const u64 high_hi_x[2] = { (u64) high_hi, (u64) (high_hi >> 64) };
+			
+			__chonky_limbs_add_in(acc, 4, low_x, 2);
+			__chonky_limbs_add_in(acc, 4, high_x, 2);
+			__chonky_limbs_add_in(acc + 1, 3, high_hi_x, 2);
+		}
+
+		rp[i] = acc[0];
+		acc[0] = acc[1], acc[1] = acc[2], acc[2] = acc[3], acc[3] = 0;
+	}
+
+	__chonky_free(temp);
+
+	return rp;
+}
+
+// rp = ap * bp, selecting the kernel by the size of the operands.
+// NOTE: rp must have space for an + bn limbs, and must not overlap the operands
+CHONKY_FAILABLE static u64* __chonky_limbs_mul(u64* rp, const u64* ap, u64 an, const u64* bp, u64 bn) {
+	if (an < bn) {
+		const u64* temp_p = ap;
+		ap = bp, bp = temp_p;
+		const u64 temp_n = an;
+		an = bn, bn = temp_n;
+	}
+
+	if (bn < CHONKY_KARATSUBA_THRESHOLD) {
+		// The IFMA kernel falls back to the basecase when out of memory
+		if (bn >= CHONKY_IFMA_THRESHOLD && __chonky_has_ifma() && __chonky_mul_ifma(rp, ap, an, bp, bn) != NULL) return rp;
+		__chonky_mul_basecase(rp, ap, an, bp, bn);
+		return rp;
+	} else if (bn >= CHONKY_NTT_THRESHOLD) {
+		return __chonky_mul_ntt(rp, ap, an, bp, bn);
+	} else if (bn <= (an + 1) / 2) {
+		return __chonky_mul_unbalanced(rp, ap, an, bp, bn);
+	} else if (bn >= CHONKY_TOOM3_THRESHOLD && bn > 2 * ((an + 2) / 3)) {
+		return __chonky_mul_toom3(rp, ap, an, bp, bn);
+	}
+
+	return __chonky_mul_karatsuba(rp, ap, an, bp, bn);
+}
+
+// NOTE: rp must have space for 2n limbs, and must not overlap the operand
+static void __chonky_sqr_basecase(u64* rp, const u64* ap, const u64 n) {
+	// Off-diagonal products a_i * a_j (i < j), each computed only once
+	rp[0] = 0;
+	rp[2 * n - 1] = 0;
+	if (n > 1) {
+		rp[n] = __chonky_limbs_mul_1(rp + 1, ap + 1, n - 1, ap[0]);
+		for (u64 i = 1; i < n - 1; ++i) {
+			rp[n + i] = __chonky_limbs_addmul_1(rp + 2 * i + 1, ap + i + 1, n - i - 1, ap[i]);
+		}
+	}
+
+	// Double the off-diagonal sum while adding the diagonal squares
+	u64 carry = 0;
+	u64 top_bit = 0;
+	for (u64 i = 0; i < n; ++i) {
+		const u64 low = rp[2 * i];
+		const u64 high = rp[2 * i + 1];
+		const u128 square = ((u128) ap[i]) * ap[i];
+		carry = _addcarry_u64(carry, (low << 1) | top_bit, (u64) square, rp + 2 * i);
+		carry = _addcarry_u64(carry, (high << 1) | (low >> 63), (u64) (square >> 64), rp + 2 * i + 1);
+		top_bit = high >> 63;
+	}
+
+	return;
+}
+
+// Same split as the multiplication, but with a^2 = a0^2 + a1^2 * B^2h +
+// (a0^2 + a1^2 - (a0 - a1)^2) * B^h, so that every sub-product is a square.
+CHONKY_FAILABLE static u64* __chonky_sqr_karatsuba(u64* rp, const u64* ap, const u64 n) {
+	const u64 h = (n + 1) / 2;
+	const u64 a1_size = n - h;
+	const u64 mid_size = 2 * h + 1;
+
+	u64* temp = __chonky_calloc(h + 2 * h + mid_size, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate karatsuba temp buffer.");
+		return NULL;
+	}
+
+	u64* diff = temp;
+	u64* diff_sqr = temp + h;
+	u64* mid = temp + 3 * h;
+
+	if (__chonky_limbs_sub(diff, ap, h, ap + h, a1_size)) {
+		for (u64 i = 0; i < h; ++i) diff[i] = ~diff[i];
+		const u64 one = 1;
+		__chonky_limbs_add_in(diff, h, &one, 1);
+	}
+
+	ChonkyProduct products[] = {
+		{ .rp = diff_sqr, .ap = diff, .an = h },
+		{ .rp = rp, .ap = ap, .an = h },
+		{ .rp = rp + 2 * h, .ap = ap + h, .an = a1_size }
+	};
+
+	if (!__chonky_products_run(products, ARR_SIZE(products), n)) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	__chonky_limbs_copy(mid, rp, 2 * h);
+	__chonky_limbs_add_in(mid, mid_size, rp + 2 * h, 2 * a1_size);
+	__chonky_limbs_sub_in(mid, mid_size, diff_sqr, 2 * h);
+	__chonky_limbs_add_in(rp + h, 2 * n - h, mid, MIN(mid_size, 2 * n - h));
+
+	__chonky_free(temp);
+
+	return rp;
+}
+
+CHONKY_FAILABLE static u64* __chonky_sqr_toom3(u64* rp, const u64* ap, const u64 n) {
+	const u64 k = (n + 2) / 3;
+	const u64 a2_size = n - 2 * k;
+	const u64 len = 2 * k + 2;
+
+	u64* temp = __chonky_calloc(3 * (k + 1) + 3 * len, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate toom3 temp buffer.");
+		return NULL;
+	}
+
+	u64* eval_a[3] = { temp, temp + (k + 1), temp + 2 * (k + 1) };
+	u64* v1 = temp + 3 * (k + 1);
+	u64* vm1 = v1 + len;
+	u64* v2 = vm1 + len;
+
+	__chonky_toom3_eval(eval_a, ap, k, a2_size);
+
+	ChonkyProduct products[] = {
+		{ .rp = v1, .ap = eval_a[0], .an = k + 1 },
+		{ .rp = vm1, .ap = eval_a[1], .an = k + 1 },
+		{ .rp = v2, .ap = eval_a[2], .an = k + 1 },
+		{ .rp = rp, .ap = ap, .an = k },
+		{ .rp = rp + 4 * k, .ap = ap + 2 * k, .an = a2_size }
+	};
+
+	if (!__chonky_products_run(products, ARR_SIZE(products), n)) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	__chonky_toom3_interpolate(rp, k, 2 * n, v1, vm1, FALSE, v2);
+
+	__chonky_free(temp);
+
+	return rp;
+}
+
+// rp = ap^2, selecting the kernel by the size of the operand.
+// NOTE: rp must have space for 2n limbs, and must not overlap the operand
+CHONKY_FAILABLE static u64* __chonky_limbs_sqr(u64* rp, const u64* ap, const u64 n) {
+	if (n < CHONKY_SQR_KARATSUBA_THRESHOLD) {
+		__chonky_sqr_basecase(rp, ap, n);
+		return rp;
+	} else if (n >= CHONKY_SQR_NTT_THRESHOLD) {
+		return __chonky_mul_ntt(rp, ap, n, NULL, n);
+	} else if (n >= CHONKY_SQR_TOOM3_THRESHOLD) {
+		return __chonky_sqr_toom3(rp, ap, n);
+	}
+
+	return __chonky_sqr_karatsuba(rp, ap, n);
+}
+
+/// -------------------------------
+///  Decimal Conversion
+/// -------------------------------
+// NOTE: Decimal digits are handled in chunks of 19, the biggest power of ten
+// fitting a limb. Short inputs are accumulated one chunk at a time, longer
+// ones are split in halves around the powers 10^(19 * 2^i), computed once per
+// conversion, so that the cost follows the subquadratic multiplication.
+#ifndef CHONKY_DEC_DC_THRESHOLD
+	#define CHONKY_DEC_DC_THRESHOLD 512
+#endif //CHONKY_DEC_DC_THRESHOLD
+
+#define CHONKY_DEC_CHUNK_DIGITS 19ULL
+#define CHONKY_DEC_CHUNK        10000000000000000000ULL
+
+// Upper bound of the limbs taken by a number of `digits` decimal digits, as
+// log2(10) < 3.322
+#define CHONKY_DEC_LIMBS(digits) ((digits) * 3322 / 1000 / 64 + 2)
+
+typedef struct ChonkyDecPowers {
+	u64* pows[64];
+	u64 sizes[64];
+	u8 count;
+} ChonkyDecPowers;
+
+static void __chonky_dec_powers_free(ChonkyDecPowers* powers) {
+	for (u8 i = 0; i < powers -> count; ++i) __chonky_free(powers -> pows[i]);
+	powers -> count = 0;
+	return;
+}
+
+// Builds 10^(19 * 2^i) by repeated squaring, as long as it has fewer than
+// `digits` digits (the first one is always present).
+CHONKY_FAILABLE static ChonkyDecPowers* __chonky_dec_powers_init(ChonkyDecPowers* powers, const u64 digits) {
+	mem_set(powers, 0, sizeof(ChonkyDecPowers));
+
+	powers -> pows[0] = __chonky_calloc(1, sizeof(u64));
+	if (powers -> pows[0] == NULL) {
+		WARNING_LOG("Failed to allocate powers of ten.");
+		return NULL;
+	}
+
+	powers -> pows[0][0] = CHONKY_DEC_CHUNK;
+	powers -> sizes[0] = 1;
+	powers -> count = 1;
+
+	for (u8 i = 1; i < ARR_SIZE(powers -> pows) && (CHONKY_DEC_CHUNK_DIGITS << i) < digits; ++i) {
+		const u64 n = powers -> sizes[i - 1];
+		powers -> pows[i] = __chonky_calloc(2 * n, sizeof(u64));
+		if (powers -> pows[i] == NULL) {
+			__chonky_dec_powers_free(powers);
+			WARNING_LOG("Failed to allocate powers of ten.");
+			return NULL;
+		}
+		
+		powers -> count++;
+		
+		if (__chonky_limbs_sqr(powers -> pows[i], powers -> pows[i - 1], n) == NULL) {
+			__chonky_dec_powers_free(powers);
+			return NULL;
+		}
+		
+		powers -> sizes[i] = __chonky_limbs_real_size(powers -> pows[i], 2 * n);
+	}
+
+	return powers;
+}
+
+static u64 __chonky_dec_chunk(const char* str, const u64 len) {
+	u64 chunk = 0;
+	for (u64 i = 0; i < len; ++i) chunk = chunk * 10 + (str[i] - '0');
+	return chunk;
+}
+
+// NOTE: rp must be zeroed, with space for CHONKY_DEC_LIMBS(len) limbs
+static void __chonky_limbs_from_dec_basecase(u64* rp, const char* str, const u64 len) {
+	const u64 head = (len % CHONKY_DEC_CHUNK_DIGITS) ? (len % CHONKY_DEC_CHUNK_DIGITS) : CHONKY_DEC_CHUNK_DIGITS;
+	rp[0] = __chonky_dec_chunk(str, MIN(head, len));
+	
+	u64 rn = 1;
+	for (u64 i = head; i < len; i += CHONKY_DEC_CHUNK_DIGITS) {
+		const u64 chunk = __chonky_dec_chunk(str + i, CHONKY_DEC_CHUNK_DIGITS);
+		u64 carry = __chonky_limbs_mul_1(rp, rp, rn, CHONKY_DEC_CHUNK);
+		carry += __chonky_limbs_add_in(rp, rn, &chunk, 1);
+		if (carry) rp[rn++] = carry;
+	}
+
+	return;
+}
+
+// value(str) = value(high) * 10^(19 * 2^i) + value(low), where low takes the
+// biggest cached power with fewer digits than the input.
+// NOTE: rp must be zeroed, with space for CHONKY_DEC_LIMBS(len) limbs
+CHONKY_FAILABLE static u64* __chonky_limbs_from_dec(u64* rp, const char* str, const u64 len, const ChonkyDecPowers* powers) {
+	if (len <= CHONKY_DEC_DC_THRESHOLD) {
+		__chonky_limbs_from_dec_basecase(rp, str, len);
+		return rp;
+	}
+
+	u8 i = powers -> count - 1;
+	while (i > 0 && (CHONKY_DEC_CHUNK_DIGITS << i) >= len) i--;
+	
+	const u64 low_len = CHONKY_DEC_CHUNK_DIGITS << i;
+	const u64 high_len = len - low_len;
+	if (__chonky_limbs_from_dec(rp, str + high_len, low_len, powers) == NULL) return NULL;
+
+	const u64 high_limbs = CHONKY_DEC_LIMBS(high_len);
+	u64* high = __chonky_calloc(2 * high_limbs + powers -> sizes[i], sizeof(u64));
+	if (high == NULL) {
+		WARNING_LOG("Failed to allocate decimal conversion buffer.");
+		return NULL;
+	}
+
+	if (__chonky_limbs_from_dec(high, str, high_len, powers) == NULL) {
+		__chonky_free(high);
+		return NULL;
+	}
+
+	const u64 hn = __chonky_limbs_real_size(high, high_limbs);
+	if (hn > 0) {
+		u64* product = high + high_limbs;
+		if (__chonky_limbs_mul(product, high, hn, powers -> pows[i], powers -> sizes[i]) == NULL) {
+			__chonky_free(high);
+			return NULL;
+		}
+		__chonky_limbs_add_in(rp, CHONKY_DEC_LIMBS(len), product, __chonky_limbs_real_size(product, hn + powers -> sizes[i]));
+	}
+
+	__chonky_free(high);
+
+	return rp;
+}
+
+#define IS_A_DEC_DIGIT(c) (((c) >= '0') && ((c) <= '9'))
+EXPORT_FUNCTION BigNum* alloc_chonky_num_from_string(const char* data_str) {
+	const u64 data_str_len = str_len(data_str);
+	if (data_str == NULL || data_str_len == 0) {
+		WARNING_LOG("Invalid parameters, string must not be empty or NULL pointer.");
+		return NULL;
+	}
+	
+	const char* digits = data_str + (*data_str == '-');
+	const u64 digits_len = data_str_len - (*data_str == '-');
+	for (u64 i = 0; i < digits_len; ++i) {
+		if (!IS_A_DEC_DIGIT(digits[i])) {
+			WARNING_LOG("'%c': is not a valid digit.", digits[i]);
+			return NULL;
+		}
+	}
+	
+	BigNum* num = alloc_chonky_num(NULL, CHONKY_DEC_LIMBS(digits_len) * 8, (data_str[0] == '-'));
+	if (num == NULL) return NULL;
+	
+	if (digits_len == 0) return num;
+
+	ChonkyDecPowers powers = {0};
+	if (digits_len > CHONKY_DEC_DC_THRESHOLD && __chonky_dec_powers_init(&powers, digits_len) == NULL) {
+		dealloc_chonky_num(num);
+		return NULL;
+	}
+
+	if (__chonky_limbs_from_dec(num -> data_64, digits, digits_len, &powers) == NULL) {
+		__chonky_dec_powers_free(&powers);
+		dealloc_chonky_num(num);
+		return NULL;
+	}
+
+	__chonky_dec_powers_free(&powers);
+	__chonky_trim(num, num -> size / 8);
+
+	if (chonky_resize(num, 0)) return NULL;
+
+	return num;
+}
+
+#define CHONKY_DEC_DIGITS(limbs) ((limbs) * 19266 / 1000 + 2)
+
+// Writes the first `len` digits of a chunk, right aligned and zero padded
+static void __chonky_dec_write_chunk(char* end, u64 chunk, const u64 len) {
+	for (u64 i = 0; i < len; ++i) {
+		*(--end) = '0' + (chunk % 10);
+		chunk /= 10;
+	}
+	return;
+}
+
+// Divides by 10^19 once per pass, emitting the remainder as the next 19 digits.
+// NOTE: 10^19 already has its top bit set, so the limbs need no normalization
+static void __chonky_limbs_to_dec_basecase(char* end, u64* ap, u64 n, u64 digits) {
+	const u64 v = __chonky_limb_reciprocal(CHONKY_DEC_CHUNK);
+	while (digits > 0) {
+		u64 rem = 0;
+		for (s64 j = n - 1; j >= 0; --j) ap[j] = __chonky_limb_div_2by1(&rem, rem, ap[j], CHONKY_DEC_CHUNK, v);
+		n = __chonky_limbs_real_size(ap, n);
+
+		const u64 len = MIN(digits, CHONKY_DEC_CHUNK_DIGITS);
+		__chonky_dec_write_chunk(end, rem, len);
+		end -= len;
+		digits -= len;
+	}
+	
+	return;
+}
+
+// Writes exactly `digits` digits ending at `end`, zero padded, the number is
+// split as q * 10^(19 * 2^i) + r with the cached power taking about half of
+// its limbs, so that the remainder fills the low 19 * 2^i digits.
+// NOTE: Requires ap < 10^digits
+CHONKY_FAILABLE static char* __chonky_limbs_to_dec(char* end, const u64* ap, u64 n, const u64 digits, const ChonkyDecPowers* powers) {
+	n = __chonky_limbs_real_size(ap, n);
+
+	u8 i = powers -> count;
+	while (i > 0 && (2 * powers -> sizes[i - 1] > n + 1 || (CHONKY_DEC_CHUNK_DIGITS << (i - 1)) >= digits)) i--;
+
+	if (digits <= CHONKY_DEC_DC_THRESHOLD || i == 0) {
+		u64* temp = __chonky_calloc(MAX(n, 1), sizeof(u64));
+		if (temp == NULL) {
+			WARNING_LOG("Failed to allocate decimal conversion buffer.");
+			return NULL;
+		}
+		__chonky_limbs_copy(temp, ap, n);
+		__chonky_limbs_to_dec_basecase(end, temp, n, digits);
+		__chonky_free(temp);
+		return end;
+	}
+
+	const u64* pp = powers -> pows[i - 1];
+	const u64 pn = powers -> sizes[i - 1];
+	const u64 low_digits = CHONKY_DEC_CHUNK_DIGITS << (i - 1);
+	
+	u64* qp = __chonky_calloc((n - pn + 1) + pn + CHONKY_DIVREM_TEMP_SIZE(n, pn), sizeof(u64));
+	if (qp == NULL) {
+		WARNING_LOG("Failed to allocate decimal conversion buffer.");
+		return NULL;
+	}
+	
+	u64* rp = qp + (n - pn + 1);
+	__chonky_limbs_divrem(qp, rp, ap, n, pp, pn, rp + pn);
+
+	if (__chonky_limbs_to_dec(end, rp, pn, low_digits, powers) == NULL || __chonky_limbs_to_dec(end - low_digits, qp, n - pn + 1, digits - low_digits, powers) == NULL) {
+		__chonky_free(qp);
+		return NULL;
+	}
+
+	__chonky_free(qp);
+
+	return end;
+}
+
+// Upper bound of the characters taken by the decimal representation of the
+// number, including the sign and the terminator.
+EXPORT_FUNCTION u64 chonky_dec_string_size(const BigNum* num) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return 0;
+	}
+
+	return CHONKY_DEC_DIGITS(chonky_real_size_64(num)) + 2;
+}
+
+// Writes the decimal representation of the number in buf, NUL terminated,
+// returns the characters written without the terminator, or 0 on failure.
+// NOTE: A buffer of chonky_dec_string_size(num) characters is always enough
+EXPORT_FUNCTION u64 chonky_to_dec_string(const BigNum* num, char* buf, const u64 buf_size) {
+	if (!IS_VALID_BIG_NUM(num) || buf == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return 0;
+	}
+
+	const u64 n = chonky_real_size_64(num);
+	const u64 digits = CHONKY_DEC_DIGITS(n);
+	const bool is_negative = num -> sign && n > 0;
+
+	// NOTE: The digits are written directly in buf, when it fits the bound
+	const bool use_temp = (buf_size < digits + is_negative + 1);
+	char* dec = use_temp ? __chonky_calloc(digits, sizeof(char)) : buf + is_negative;
+	if (dec == NULL) {
+		WARNING_LOG("Failed to allocate decimal conversion buffer.");
+		return 0;
+	}
+
+	ChonkyDecPowers powers = {0};
+	if (digits > CHONKY_DEC_DC_THRESHOLD && __chonky_dec_powers_init(&powers, digits / 2) == NULL) {
+		if (use_temp) __chonky_free(dec);
+		return 0;
+	}
+
+	if (__chonky_limbs_to_dec(dec + digits, num -> data_64, n, digits, &powers) == NULL) {
+		__chonky_dec_powers_free(&powers);
+		if (use_temp) __chonky_free(dec);
+		return 0;
+	}
+
+	__chonky_dec_powers_free(&powers);
+
+	u64 zeros = 0;
+	while (zeros < digits - 1 && dec[zeros] == '0') zeros++;
+	
+	const u64 len = digits - zeros + is_negative;
+	if (buf_size < len + 1) {
+		WARNING_LOG("Buffer too small, %llu characters are needed.", len + 1);
+		if (use_temp) __chonky_free(dec);
+		return 0;
+	}
+
+	if (is_negative) buf[0] = '-';
+	mem_cpy(buf + is_negative, dec + zeros, digits - zeros);
+	buf[len] = '\0';
+
+	if (use_temp) __chonky_free(dec);
+
+	return len;
+}
+
+#define PRINT_CHONKY_NUM(num)     print_chonky_num(#num, num, TRUE)
+#define PRINT_CHONKY_NUM_DEC(num) print_chonky_num(#num, num, FALSE)
+EXPORT_FUNCTION void print_chonky_num(char* name, BigNum* num, bool use_hex) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid big num.");
+		return;
+	}
+	
+	const u64 real_size = chonky_real_size(num);
+	printf("%s: %s", name, num -> sign ? "-" : "");
+
+	if (use_hex) {
+		for (s64 i = real_size - 1; i >= 0; --i) {
+			printf("%02X", (num -> data)[i]);
+		}
+	} else {
+		const u64 buf_size = chonky_dec_string_size(num);
+		char* buf = __chonky_calloc(buf_size, sizeof(char));
+		if (buf == NULL) {
+			WARNING_LOG("Failed to alloc the buffer.");
+			return;
+		}
+
+		// NOTE: The sign has already been printed
+		BigNum num_abs = *num;
+		num_abs.sign = 0;
+		if (chonky_to_dec_string(&num_abs, buf, buf_size)) printf("%s", buf);
+		
+		__chonky_free(buf);
+	}
+
+	printf(" (size: %llu, real size: %llu)\n", num -> size, real_size);
+
+	return;
+}
+
+/// -------------------------------
+///  Internal Operations Functions
+/// -------------------------------
+static BigNum* __chonky_add(BigNum* res, const BigNum* a, const BigNum* b) {
+	const u64 a_size = chonky_real_size_64(a);
+	const u64 b_size = chonky_real_size_64(b);
+	const u64 size = MIN(res -> size / 8, MAX(a_size, b_size) + 1); 
+
+	u64 carry = 0;
+	for (u64 i = 0; i < size; ++i) {
+  		const u64 a_val = -((u64) (i < a_size)) & (a -> data_64)[i];
+  		const u64 b_val = -((u64) (i < b_size)) & (b -> data_64)[i];
+		carry = _addcarry_u64(carry, a_val, b_val, res -> data_64 + i);
+	}
+
+	// Clear what is left of the previous value
+	if (res -> limbs > size) __chonky_limbs_zero(res -> data_64 + size, res -> limbs - size);
+
+	return __chonky_trim(res, size);
+}
+
+static BigNum* __chonky_sub(BigNum* res, const BigNum* a, const BigNum* b) {
+	const u64 a_size = chonky_real_size_64(a);
+	const u64 b_size = chonky_real_size_64(b);
+	const u64 size = MIN(res -> size / 8, MAX(a_size, b_size) + 1); 
+	
+	u64 carry = 0;
+	for (u64 i = 0; i < size; ++i) {
+        const u64 a_val = -((u64) (i < a_size)) & (a -> data_64)[i];
+  		const u64 b_val = -((u64) (i < b_size)) & (b -> data_64)[i];
+		carry = _subborrow_u64(carry, a_val, b_val, res -> data_64 + i);
+	}
+	
+	res -> sign = carry;
+
+	const u64 mask = -((u64) carry);
+	if (res -> sign) {
+   		for (u64 i = 0; i < size; ++i) {
+  			(res -> data_64)[i] ^= mask;
+  			carry = _addcarry_u64(carry, (res -> data_64)[i], 0, res -> data_64 + i);
+   		}
+ 	}
+
+	if (res -> limbs > size) __chonky_limbs_zero(res -> data_64 + size, res -> limbs - size);
+
+	return __chonky_trim(res, size);
+}
+
+// res = num << bit_cnt over the magnitude: whole limbs are moved by the index
+// and the rest by a single funnel shift pass, (x >> 1) >> (63 - cnt) keeps it
+// branchless when cnt is zero. The limbs are written from the top, so that
+// res can alias num.
+// NOTE: res must have space for the used limbs of num + bit_cnt / 64 + 1
+static BigNum* __chonky_shl(BigNum* res, const BigNum* num, const u64 bit_cnt) {
+	const u64 n = num -> limbs;
+	const u64 shift = bit_cnt / 64;
+	const u8 cnt = bit_cnt % 64;
+	const u64 prev_limbs = res -> limbs;
+	const u64* ap = num -> data_64;
+	u64* rp = res -> data_64;
+
+	if (n == 0) {
+		__chonky_limbs_zero(rp, prev_limbs);
+		return __chonky_trim(res, 0);
+	}
+
+	rp[n + shift] = (ap[n - 1] >> 1) >> (63 - cnt);
+	for (u64 i = n - 1; i > 0; --i) rp[i + shift] = (ap[i] << cnt) | ((ap[i - 1] >> 1) >> (63 - cnt));
+	rp[shift] = ap[0] << cnt;
+	__chonky_limbs_zero(rp, shift);
+
+	// Clear what is left of the previous value
+	if (prev_limbs > n + shift + 1) __chonky_limbs_zero(rp + n + shift + 1, prev_limbs - n - shift - 1);
+
+	return __chonky_trim(res, n + shift + 1);
+}
+
+// res = num >> bit_cnt over the magnitude, written from the bottom, so that
+// res can alias num.
+// NOTE: res must have space for the used limbs of num - bit_cnt / 64
+static BigNum* __chonky_shr(BigNum* res, const BigNum* num, const u64 bit_cnt) {
+	const u64 n = num -> limbs;
+	const u64 shift = bit_cnt / 64;
+	const u8 cnt = bit_cnt % 64;
+	const u64 prev_limbs = res -> limbs;
+	const u64 rn = (shift < n) ? n - shift : 0;
+	const u64* ap = num -> data_64 + shift;
+	u64* rp = res -> data_64;
+
+	if (rn > 0) {
+		for (u64 i = 0; i + 1 < rn; ++i) rp[i] = (ap[i] >> cnt) | ((ap[i + 1] << 1) << (63 - cnt));
+		rp[rn - 1] = ap[rn - 1] >> cnt;
+	}
+
+	if (prev_limbs > rn) __chonky_limbs_zero(rp + rn, prev_limbs - rn);
+
+	return __chonky_trim(res, rn);
+}
+
+// res = num mod 2^bit_cnt over the magnitude, res can alias num
+// NOTE: res must have space for MIN(used limbs of num, ceil(bit_cnt / 64)) limbs
+static BigNum* __chonky_mask(BigNum* res, const BigNum* num, const u64 bit_cnt) {
+	const u64 mask_limbs = (bit_cnt + 63) / 64;
+	const u64 rn = MIN(num -> limbs, mask_limbs);
+	const u64 prev_limbs = res -> limbs;
+	u64* rp = res -> data_64;
+
+	if (rp != num -> data_64) __chonky_limbs_copy(rp, num -> data_64, rn);
+	if (rn == mask_limbs && bit_cnt % 64) rp[rn - 1] &= (1ULL << (bit_cnt % 64)) - 1;
+
+	if (prev_limbs > rn) __chonky_limbs_zero(rp + rn, prev_limbs - rn);
+
+	return __chonky_trim(res, rn);
+}
+
+// res = (2^bit_cnt - 1) ^ (num mod 2^bit_cnt) over the magnitude, res can alias num
+// NOTE: res must have space for ceil(bit_cnt / 64) limbs
+static BigNum* __chonky_not(BigNum* res, const BigNum* num, const u64 bit_cnt) {
+	const u64 rn = (bit_cnt + 63) / 64;
+	const u64 an = MIN(num -> limbs, rn);
+	const u64 prev_limbs = res -> limbs;
+	const u64* ap = num -> data_64;
+	u64* rp = res -> data_64;
+
+	u64 i = 0;
+	for (; i < an; ++i) rp[i] = ~ap[i];
+	for (; i < rn; ++i) rp[i] = ~0ULL;
+	if (bit_cnt % 64) rp[rn - 1] &= (1ULL << (bit_cnt % 64)) - 1;
+
+	if (prev_limbs > rn) __chonky_limbs_zero(rp + rn, prev_limbs - rn);
+
+	return __chonky_trim(res, rn);
+}
+
+// NOTE: The bitwise operations act on the magnitudes, res can alias the
+// operands and must have space for the used limbs of the longest one
+static BigNum* __chonky_and(BigNum* res, const BigNum* a, const BigNum* b) {
+	const u64 n = MIN(a -> limbs, b -> limbs);
+	const u64 prev_limbs = res -> limbs;
+
+	__chonky_limbs_and(res -> data_64, a -> data_64, b -> data_64, n);
+	if (prev_limbs > n) __chonky_limbs_zero(res -> data_64 + n, prev_limbs - n);
+
+	return __chonky_trim(res, n);
+}
+
+static BigNum* __chonky_or_xor(BigNum* res, const BigNum* a, const BigNum* b, const bool is_xor) {
+	if (a -> limbs < b -> limbs) {
+		const BigNum* temp = a;
+		a = b, b = temp;
+	}
+
+	const u64 an = a -> limbs;
+	const u64 bn = b -> limbs;
+	const u64 prev_limbs = res -> limbs;
+	u64* rp = res -> data_64;
+
+	if (is_xor) __chonky_limbs_xor(rp, a -> data_64, b -> data_64, bn);
+	else __chonky_limbs_or(rp, a -> data_64, b -> data_64, bn);
+	if (rp != a -> data_64) __chonky_limbs_copy(rp + bn, a -> data_64 + bn, an - bn);
+
+	if (prev_limbs > an) __chonky_limbs_zero(rp + an, prev_limbs - an);
+
+	return __chonky_trim(res, an);
+}
+
+CHONKY_FAILABLE static BigNum* __chonky_mul_s(BigNum* res, const BigNum* a, const BigNum* b) {
+	const u64 a_size = chonky_real_size_64(a);
+	const u64 b_size = chonky_real_size_64(b);
+	const u64 size = res -> size / 8;
+	CHONKY_ASSERT(size > (a_size + b_size));
+
+	if (a_size == 0 || b_size == 0) {
+		__chonky_limbs_zero(res -> data_64, size);
+		res -> limbs = 0;
+		return res;
+	}
+
+	// NOTE: The result can alias the operands, in that case use a temp buffer
+	const bool is_aliased = (res -> data == a -> data) || (res -> data == b -> data);
+	u64* product = res -> data_64;
+	if (is_aliased) {
+		product = __chonky_calloc(a_size + b_size, sizeof(u64));
+		if (product == NULL) {
+			WARNING_LOG("Failed to allocate product buffer.");
+			return NULL;
+		}
+	}
+
+	if (__chonky_limbs_mul(product, a -> data_64, a_size, b -> data_64, b_size) == NULL) {
+		if (is_aliased) __chonky_free(product);
+		return NULL;
+	}
+
+	if (is_aliased) {
+		__chonky_limbs_copy(res -> data_64, product, a_size + b_size);
+		__chonky_free(product);
+	}
+
+	__chonky_limbs_zero(res -> data_64 + a_size + b_size, size - a_size - b_size);
+
+	return __chonky_trim(res, a_size + b_size);
+}
+
+CHONKY_FAILABLE static BigNum* __chonky_sqr_s(BigNum* res, const BigNum* a) {
+	const u64 a_size = chonky_real_size_64(a);
+	const u64 size = res -> size / 8;
+	CHONKY_ASSERT(size > 2 * a_size);
+
+	if (a_size == 0) {
+		__chonky_limbs_zero(res -> data_64, size);
+		res -> limbs = 0;
+		return res;
+	}
+
+	// NOTE: The result can alias the operand, in that case use a temp buffer
+	const bool is_aliased = (res -> data == a -> data);
+	u64* square = res -> data_64;
+	if (is_aliased) {
+		square = __chonky_calloc(2 * a_size, sizeof(u64));
+		if (square == NULL) {
+			WARNING_LOG("Failed to allocate square buffer.");
+			return NULL;
+		}
+	}
+
+	if (__chonky_limbs_sqr(square, a -> data_64, a_size) == NULL) {
+		if (is_aliased) __chonky_free(square);
+		return NULL;
+	}
+
+	if (is_aliased) {
+		__chonky_limbs_copy(res -> data_64, square, 2 * a_size);
+		__chonky_free(square);
+	}
+
+	__chonky_limbs_zero(res -> data_64 + 2 * a_size, size - 2 * a_size);
+
+	return __chonky_trim(res, 2 * a_size);
+}
+
+// Truncated division of the magnitudes, the signs are left to the caller.
+// NOTE: Either quotient or remainder can be NULL, the quotient must have space
+// for the limbs of a and the remainder for the limbs of b (or of a, if smaller).
+CHONKY_FAILABLE static BigNum* __chonky_divmod(BigNum* quotient, BigNum* remainder, const BigNum* a, const BigNum* b) {
+	const u64 a_size = chonky_real_size_64(a);
+	const u64 b_size = chonky_real_size_64(b);
+	CHONKY_ASSERT(b_size > 0);
+	
+	BigNum* res = (quotient != NULL) ? quotient : remainder;
+
+	if (a_size < b_size) {
+		if (remainder != NULL) {
+			CHONKY_ASSERT(remainder -> size / 8 >= a_size);
+			if (remainder -> data != a -> data) __chonky_limbs_copy(remainder -> data_64, a -> data_64, a_size);
+			__chonky_limbs_zero(remainder -> data_64 + a_size, remainder -> size / 8 - a_size);
+			remainder -> limbs = a_size;
+		}
+		
+		if (quotient != NULL) {
+			__chonky_limbs_zero(quotient -> data_64, quotient -> size / 8);
+			quotient -> limbs = 0;
+		}
+		
+		return res;
+	}
+
+	const u64 q_size = a_size - b_size + 1;
+	CHONKY_ASSERT(quotient == NULL || quotient -> size / 8 >= q_size);
+	CHONKY_ASSERT(remainder == NULL || remainder -> size / 8 >= b_size);
+
+	u64* temp = __chonky_calloc(CHONKY_DIVREM_TEMP_SIZE(a_size, b_size), sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate division buffer.");
+		return NULL;
+	}
+
+	u64* qp = (quotient != NULL) ? quotient -> data_64 : NULL;
+	u64* rp = (remainder != NULL) ? remainder -> data_64 : NULL;
+	__chonky_limbs_divrem(qp, rp, a -> data_64, a_size, b -> data_64, b_size, temp);
+	
+	if (quotient != NULL) {
+		__chonky_limbs_zero(quotient -> data_64 + q_size, quotient -> size / 8 - q_size);
+		__chonky_trim(quotient, q_size);
+	}
+	
+	if (remainder != NULL) {
+		__chonky_limbs_zero(remainder -> data_64 + b_size, remainder -> size / 8 - b_size);
+		__chonky_trim(remainder, b_size);
+	}
+
+	__chonky_free(temp);
+
+	return res;
+}
+
+// NOTE: The exponentiation engine is shared by every representation, each one
+// provides its own multiplication and squaring working on elements of `size`
+// limbs, with a scratch buffer of `temp_size` limbs. The result can alias
+// the operands.
+typedef struct ChonkyPowOps {
+	u64* (*mul)(const struct ChonkyPowOps* ops, u64* rp, const u64* ap, const u64* bp, u64* temp);
+	u64* (*sqr)(const struct ChonkyPowOps* ops, u64* rp, const u64* ap, u64* temp);
+	const void* ctx;
+	u64 size;
+	u64 temp_size;
+} ChonkyPowOps;
+
+// Window size as a function of the exponent size, as the table of odd powers
+// costs 2^(w-1) multiplications, which must be amortized by the exponent.
+static u8 __chonky_window_size(const u64 exp_bit_size) {
+	const u64 thresholds[] = { 7, 36, 140, 450, 1303, 3529 };
+	u8 window = 1;
+	while (window <= ARR_SIZE(thresholds) && exp_bit_size > thresholds[window - 1]) window++;
+	return window;
+}
+
+#define EXP_BIT(exp, i) GET_BIT(((exp) -> data_64)[(i) / 64], (i) % 64)
+
+// Left-to-right sliding window exponentiation, acc = base^exp, where acc is
+// expected to hold the representation of one (returned as is for exp = 0).
+// Only the odd powers of the base are precomputed, so that every window costs
+// a single multiplication, on top of the squarings.
+CHONKY_FAILABLE static u64* __chonky_pow_window(const ChonkyPowOps* ops, u64* acc, const u64* base, const BigNum* exp) {
+	const u64 exp_bit_size = is_chonky_zero((BigNum*) exp) ? 0 : chonky_bit_size(exp);
+	if (exp_bit_size == 0) return acc;
+
+	const u64 n = ops -> size;
+	const u8 window = __chonky_window_size(exp_bit_size);
+	const u64 table_size = 1ULL << (window - 1);
+
+	u64* temp = __chonky_calloc(ops -> temp_size + (table_size + 1) * n, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate the window table.");
+		return NULL;
+	}
+
+	u64* table = temp + ops -> temp_size;
+	u64* base_sqr = table + table_size * n;
+
+	// table[i] = base^(2i + 1)
+	__chonky_limbs_copy(table, base, n);
+	if (table_size > 1 && ops -> sqr(ops, base_sqr, base, temp) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	for (u64 i = 1; i < table_size; ++i) {
+		if (ops -> mul(ops, table + i * n, table + (i - 1) * n, base_sqr, temp) == NULL) {
+			__chonky_free(temp);
+			return NULL;
+		}
+	}
+
+	bool is_one = TRUE;
+	s64 i = exp_bit_size - 1;
+	while (i >= 0) {
+		if (!EXP_BIT(exp, i)) {
+			if (ops -> sqr(ops, acc, acc, temp) == NULL) {
+				__chonky_free(temp);
+				return NULL;
+			}
+			i--;
+			continue;
+		}
+
+		// Longest window starting at i and ending with a set bit
+		s64 low = MAX(i - window + 1, 0);
+		while (!EXP_BIT(exp, low)) low++;
+
+		u64 value = 0;
+		for (s64 j = i; j >= low; --j) value = (value << 1) | EXP_BIT(exp, j);
+		const u64* power = table + ((value - 1) / 2) * n;
+
+		if (is_one) {
+			__chonky_limbs_copy(acc, power, n);
+			is_one = FALSE;
+		} else {
+			for (s64 j = low; j <= i; ++j) {
+				if (ops -> sqr(ops, acc, acc, temp) == NULL) {
+					__chonky_free(temp);
+					return NULL;
+				}
+			}
+
+			if (ops -> mul(ops, acc, acc, power, temp) == NULL) {
+				__chonky_free(temp);
+				return NULL;
+			}
+		}
+
+		i = low - 1;
+	}
+
+	__chonky_free(temp);
+
+	return acc;
+}
+
+// Plain integers are handled modulo B^size, as the result is known to fit,
+// every used power of the base fits as well.
+static u64* __chonky_pow_ops_plain_mul(const ChonkyPowOps* ops, u64* rp, const u64* ap, const u64* bp, u64* temp) {
+	const u64 n = ops -> size;
+	const u64 a_size = __chonky_limbs_real_size(ap, n);
+	const u64 b_size = __chonky_limbs_real_size(bp, n);
+	if (a_size == 0 || b_size == 0) {
+		__chonky_limbs_zero(rp, n);
+		return rp;
+	}
+
+	if (__chonky_limbs_mul(temp, ap, a_size, bp, b_size) == NULL) return NULL;
+	
+	const u64 size = MIN(a_size + b_size, n);
+	__chonky_limbs_copy(rp, temp, size);
+	__chonky_limbs_zero(rp + size, n - size);
+	
+	return rp;
+}
+
+static u64* __chonky_pow_ops_plain_sqr(const ChonkyPowOps* ops, u64* rp, const u64* ap, u64* temp) {
+	const u64 n = ops -> size;
+	const u64 a_size = __chonky_limbs_real_size(ap, n);
+	if (a_size == 0) {
+		__chonky_limbs_zero(rp, n);
+		return rp;
+	}
+
+	if (__chonky_limbs_sqr(temp, ap, a_size) == NULL) return NULL;
+	
+	const u64 size = MIN(2 * a_size, n);
+	__chonky_limbs_copy(rp, temp, size);
+	__chonky_limbs_zero(rp + size, n - size);
+	
+	return rp;
+}
+
+CHONKY_FAILABLE static BigNum* __chonky_pow(BigNum* res, const BigNum* num, const BigNum* exp) {
+	const u64 n = res -> size / 8;
+	
+	u64* base = __chonky_calloc(n, sizeof(u64));
+	if (base == NULL) {
+		WARNING_LOG("Failed to allocate base buffer.");
+		return NULL;
+	}
+
+	__chonky_limbs_copy(base, num -> data_64, MIN(chonky_real_size_64(num), n));
+	__chonky_limbs_zero(res -> data_64, n);
+	(res -> data_64)[0] = 1;
+
+	const ChonkyPowOps ops = {
+		.mul = __chonky_pow_ops_plain_mul,
+		.sqr = __chonky_pow_ops_plain_sqr,
+		.ctx = NULL,
+		.size = n,
+		.temp_size = 2 * n
+	};
+
+	if (__chonky_pow_window(&ops, res -> data_64, base, exp) == NULL) {
+		__chonky_free(base);
+		return NULL;
+	}
+
+	__chonky_free(base);
+
+	return __chonky_trim(res, n);
+}
+
+CHONKY_FAILABLE static BigNum* __chonky_mod(BigNum* res, const BigNum* num, const BigNum* base) {
+	return __chonky_divmod(NULL, res, num, base);
+}
+
+/// -------------------------------
+///  GCD and Modular Inverse
+/// -------------------------------
+// NOTE: Lehmer's extended gcd. While the remainders span more than one limb,
+// the Euclidean steps are simulated over their top 62 bits (taken at the same
+// shift) with single-word cosequences, for as long as both bounds of Knuth's
+// Algorithm L agree on the quotient, and then applied at once through the 2x2
+// matrix of single-word cofactors. When not even one step can be simulated,
+// as the remainders differ too much in size, a full division step is taken.
+// Along the sequence r_i = s_i * a (mod b) the cofactors alternate in sign,
+// so only their magnitudes are kept, together with the parity of i.
+#define CHONKY_GCD_TEMP_SIZE(n) (4 * ((n) + 1) + 4 * ((n) + 2) + 3 * (n) + 4 + CHONKY_DIVREM_TEMP_SIZE((n) + 1, n))
+
+// Returns the 64 bits of ap starting from bit pos, zero beyond the n limbs
+static inline u64 __chonky_limbs_bits_at(const u64* ap, const u64 n, const u64 pos) {
+	const u64 i = pos / 64;
+	const u8 cnt = pos % 64;
+	const u64 lo = (i < n) ? ap[i] >> cnt : 0;
+	const u64 hi = (i + 1 < n) ? (ap[i + 1] << 1) << (63 - cnt) : 0;
+	return lo | hi;
+}
+
+// rp = x * ap + y * bp over n limbs plus the top one, for x and y of opposite
+// signs (or one of them zero) and a non-negative result.
+static void __chonky_limbs_lincomb(u64* rp, const u64* ap, const u64* bp, const u64 n, const s64 x, const s64 y) {
+	if (y <= 0) {
+		rp[n] = __chonky_limbs_mul_1(rp, ap, n, x);
+		rp[n] -= __chonky_limbs_submul_1(rp, bp, n, -y);
+	} else {
+		rp[n] = __chonky_limbs_mul_1(rp, bp, n, y);
+		rp[n] -= __chonky_limbs_submul_1(rp, ap, n, -x);
+	}
+	return;
+}
+
+// g = gcd(|a|, |b|) and, if s is not NULL, s such that g = s * |a| (mod |b|),
+// with |s| <= MAX(|b|, 1).
+// NOTE: g must have space for MAX(used limbs of a, used limbs of b, 1) limbs
+// and s for two more, both can alias the operands.
+CHONKY_FAILABLE static BigNum* __chonky_gcdext(BigNum* g, BigNum* s, const BigNum* a, const BigNum* b) {
+	const u64 n = MAX(MAX(a -> limbs, b -> limbs), 1);
+	const u64 un = n + 2;
+	u64* temp = __chonky_calloc(CHONKY_GCD_TEMP_SIZE(n), sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate gcd buffers.");
+		return NULL;
+	}
+
+	u64* r0 = temp;
+	u64* r1 = r0 + n + 1;
+	u64* t0 = r1 + n + 1;
+	u64* t1 = t0 + n + 1;
+	u64* u0 = t1 + n + 1;
+	u64* u1 = u0 + un;
+	u64* v0 = u1 + un;
+	u64* v1 = v0 + un;
+	u64* qp = v1 + un;
+	u64* prod = qp + n + 1;
+	u64* div_temp = prod + 2 * n + 3;
+
+	__chonky_limbs_copy(r0, a -> data_64, a -> limbs);
+	__chonky_limbs_copy(r1, b -> data_64, b -> limbs);
+	u64 n0 = a -> limbs;
+	u64 n1 = b -> limbs;
+	u0[0] = 1;
+	u8 parity = 0;
+
+	#define CHONKY_SWAP_LIMBS(x, y) do { u64* swap_temp = x; x = y, y = swap_temp; } while (0)
+	while (n1 > 0) {
+		if (n0 < n1 || (n0 == n1 && __chonky_limbs_cmp(r0, r1, n0) < 0)) {
+			// Step with a zero quotient
+			CHONKY_SWAP_LIMBS(r0, r1);
+			CHONKY_SWAP_LIMBS(u0, u1);
+			const u64 temp_n = n0;
+			n0 = n1, n1 = temp_n;
+			parity ^= 1;
+			continue;
+		} else if (n0 == 1) {
+			u64 x = r0[0];
+			u64 y = r1[0];
+			while (y != 0) {
+				const u64 q = x / y;
+				const u64 r = x - q * y;
+				x = y, y = r;
+				if (s != NULL) {
+					__chonky_limbs_addmul_1(u0, u1, un, q);
+					CHONKY_SWAP_LIMBS(u0, u1);
+				}
+				parity ^= 1;
+			}
+			r0[0] = x, r1[0] = 0;
+			n1 = 0;
+			break;
+		}
+
+		const u64 shift = n0 * 64 - __builtin_clzll(r0[n0 - 1]) - 62;
+		s64 x = __chonky_limbs_bits_at(r0, n0, shift);
+		s64 y = __chonky_limbs_bits_at(r1, n1, shift);
+		s64 m00 = 1, m01 = 0, m10 = 0, m11 = 1;
+		u64 steps = 0;
+		while (y + m10 > 0 && y + m11 > 0) {
+			const s64 q = (x + m00) / (y + m10);
+			if (q != (x + m01) / (y + m11)) break;
+
+			s64 temp_m = m00 - q * m10;
+			m00 = m10, m10 = temp_m;
+			temp_m = m01 - q * m11;
+			m01 = m11, m11 = temp_m;
+			temp_m = x - q * y;
+			x = y, y = temp_m;
+			steps++;
+		}
+
+		if (steps == 0) {
+			// r0 = q * r1 + t0, then (r0, r1) = (r1, t0) and u0 += q * u1
+			__chonky_limbs_divrem(qp, t0, r0, n0, r1, n1, div_temp);
+			if (s != NULL) {
+				const u64 qn = __chonky_limbs_real_size(qp, n0 - n1 + 1);
+				const u64 u1n = __chonky_limbs_real_size(u1, un);
+				if (u1n > 0) {
+					if (__chonky_limbs_mul(prod, qp, qn, u1, u1n) == NULL) {
+						__chonky_free(temp);
+						return NULL;
+					}
+					__chonky_limbs_add_in(u0, un, prod, MIN(qn + u1n, un));
+				}
+				CHONKY_SWAP_LIMBS(u0, u1);
+			}
+
+			__chonky_limbs_zero(t0 + n1, n + 1 - n1);
+			CHONKY_SWAP_LIMBS(r0, r1);
+			CHONKY_SWAP_LIMBS(r1, t0);
+			n0 = n1;
+			n1 = __chonky_limbs_real_size(r1, n1);
+			parity ^= 1;
+			continue;
+		}
+
+		// (r0, r1) = (m00 * r0 + m01 * r1, m10 * r0 + m11 * r1)
+		__chonky_limbs_lincomb(t0, r0, r1, n0, m00, m01);
+		__chonky_limbs_lincomb(t1, r0, r1, n0, m10, m11);
+		CHONKY_SWAP_LIMBS(r0, t0);
+		CHONKY_SWAP_LIMBS(r1, t1);
+		n1 = __chonky_limbs_real_size(r1, n0 + 1);
+		n0 = __chonky_limbs_real_size(r0, n0 + 1);
+		
+		// The products of the cofactors all have the same sign
+		if (s != NULL) {
+			__chonky_limbs_mul_1(v0, u0, un, (m00 < 0) ? -m00 : m00);
+			__chonky_limbs_addmul_1(v0, u1, un, (m01 < 0) ? -m01 : m01);
+			__chonky_limbs_mul_1(v1, u0, un, (m10 < 0) ? -m10 : m10);
+			__chonky_limbs_addmul_1(v1, u1, un, (m11 < 0) ? -m11 : m11);
+			CHONKY_SWAP_LIMBS(u0, v0);
+			CHONKY_SWAP_LIMBS(u1, v1);
+		}
+
+		parity ^= steps & 1;
+	}
+	#undef CHONKY_SWAP_LIMBS
+
+	const u64 prev_limbs = g -> limbs;
+	__chonky_limbs_copy(g -> data_64, r0, n0);
+	if (prev_limbs > n0) __chonky_limbs_zero(g -> data_64 + n0, prev_limbs - n0);
+	__chonky_trim(g, n0);
+	g -> sign = 0;
+
+	if (s != NULL) {
+		const u64 prev_s_limbs = s -> limbs;
+		__chonky_limbs_copy(s -> data_64, u0, un);
+		if (prev_s_limbs > un) __chonky_limbs_zero(s -> data_64 + un, prev_s_limbs - un);
+		__chonky_trim(s, un);
+		s -> sign = is_chonky_zero(s) ? 0 : parity;
+	}
+
+	__chonky_free(temp);
+
+	return g;
+}
+
+// res = num^-1 mod |mod|, returns NULL when num and mod are not coprime
+// NOTE: res must have space for the used limbs of mod, it can alias the operands
+CHONKY_FAILABLE static BigNum* __chonky_invert(BigNum* res, const BigNum* num, const BigNum* mod) {
+	const u64 n = MAX(num -> limbs, mod -> limbs);
+	const u64 mn = mod -> limbs;
+	BigNum* g = alloc_chonky_num(NULL, n * 8, 0);
+	BigNum* s = alloc_chonky_num(NULL, (n + 2) * 8, 0);
+	if (g == NULL || s == NULL || __chonky_gcdext(g, s, num, mod) == NULL) {
+		if (g != NULL) dealloc_chonky_num(g);
+		if (s != NULL) dealloc_chonky_num(s);
+		return NULL;
+	} else if (g -> limbs != 1 || (g -> data_64)[0] != 1) {
+		DEALLOC_CHONKY_NUMS(g, s);
+		return NULL;
+	}
+
+	// |s| <= |mod|, and the sign of num flips the one of the inverse
+	u64* sp = s -> data_64;
+	const u64* mp = mod -> data_64;
+	const bool is_negative = (s -> sign ^ num -> sign) && !is_chonky_zero(s);
+	if (is_negative) __chonky_limbs_sub(sp, mp, mn, sp, mn);
+	if (__chonky_limbs_cmp(sp, mp, mn) >= 0) __chonky_limbs_sub(sp, sp, mn, mp, mn);
+
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, sp, mn);
+	__chonky_trim(res, mn);
+	res -> sign = 0;
+
+	DEALLOC_CHONKY_NUMS(g, s);
+
+	return res;
+}
+
+/// -------------------------------
+///  Montgomery Arithmetic
+/// -------------------------------
+// NOTE: The context stores the modulus in n limbs, R = 2^(64 * n), so it is
+// only valid for odd moduli. Values in Montgomery form are x * R mod m.
+// When the IFMA kernels are picked, the modulus is also kept in `digits`
+// digits of 52 bits and R = 2^(52 * digits) instead.
+EXPORT_STRUCTURE typedef struct ChonkyMontgomery {
+	BigNum* mod;
+	BigNum* r2;
+	u64 m_inv;
+	u64 size;
+	u64* mod_digits;
+	u64 digits;
+	u8 is_pooled;
+} ChonkyMontgomery;
+
+static inline u64 __chonky_mont_temp_size(const ChonkyMontgomery* ctx) {
+	return (ctx -> digits != 0) ? CHONKY_IFMA_MONT_TEMP_SIZE(ctx -> size) : 2 * ctx -> size + 2;
+}
+
+// Final step of both kernels: rp = tp - m if tp >= m, where tp has n + 1 limbs
+static void __chonky_mont_final_sub(const ChonkyMontgomery* ctx, u64* rp, const u64* tp) {
+	const u64 n = ctx -> size;
+	if (tp[n] || __chonky_limbs_cmp(tp, ctx -> mod -> data_64, n) >= 0) {
+		__chonky_limbs_sub(rp, tp, n, ctx -> mod -> data_64, n);
+	} else {
+		__chonky_limbs_copy(rp, tp, n);
+	}
+	return;
+}
+
+// CIOS Montgomery multiplication, rp = ap * bp * R^-1 mod m, every multiplication
+// step is directly followed by the reduction of the lowest limb, which is
+// then dropped by moving the window one limb up.
+// NOTE: temp must have space for __chonky_mont_temp_size limbs, rp can alias the operands
+static void __chonky_mont_mul(const ChonkyMontgomery* ctx, u64* rp, const u64* ap, const u64* bp, u64* temp) {
+	const u64 n = ctx -> size;
+	const u64* mp = ctx -> mod -> data_64;
+	
+	if (ctx -> digits != 0) {
+		const u64 dp = CHONKY_IFMA_PADDED_DIGITS(n);
+		u64* a_digits = temp;
+		u64* b_digits = a_digits + dp;
+		u64* tp = b_digits + 2 * dp;
+		__chonky_ifma_from_limbs(a_digits, dp, ap, n);
+		__chonky_ifma_from_limbs(b_digits, dp, bp, n);
+		
+		// The result takes dp + 1 digits, over the no longer needed operands
+		__chonky_mont_mul_ifma(a_digits, a_digits, b_digits, ctx -> mod_digits, ctx -> m_inv & CHONKY_IFMA_DIGIT_MASK, ctx -> digits, b_digits + dp);
+		__chonky_ifma_to_limbs(tp, n + 1, a_digits, dp + 1);
+		__chonky_mont_final_sub(ctx, rp, tp);
+		return;
+	}
+
+	__chonky_limbs_zero(temp, 2 * n + 2);
+
+	for (u64 i = 0; i < n; ++i) {
+		u64* tp = temp + i;
+		u64 carry = __chonky_limbs_addmul_1(tp, ap, n, bp[i]);
+		__chonky_limbs_add_in(tp + n, 2, &carry, 1);
+		
+		const u64 q = tp[0] * ctx -> m_inv;
+		carry = __chonky_limbs_addmul_1(tp, mp, n, q);
+		__chonky_limbs_add_in(tp + n, 2, &carry, 1);
+	}
+
+	__chonky_mont_final_sub(ctx, rp, temp + n);
+
+	return;
+}
+
+// Montgomery reduction, rp = tp * R^-1 mod m, with tp of 2n + 1 limbs
+static void __chonky_mont_redc(const ChonkyMontgomery* ctx, u64* rp, u64* tp) {
+	const u64 n = ctx -> size;
+	const u64* mp = ctx -> mod -> data_64;
+
+	for (u64 i = 0; i < n; ++i) {
+		const u64 q = tp[i] * ctx -> m_inv;
+		const u64 carry = __chonky_limbs_addmul_1(tp + i, mp, n, q);
+		__chonky_limbs_add_in(tp + i + n, n + 1 - i, &carry, 1);
+	}
+
+	__chonky_mont_final_sub(ctx, rp, tp + n);
+
+	return;
+}
+
+// Montgomery squaring, goes through the dedicated squaring kernel before
+// reducing, rp = ap^2 * R^-1 mod m.
+// NOTE: temp must have space for __chonky_mont_temp_size limbs, rp can alias the operand
+CHONKY_FAILABLE static u64* __chonky_mont_sqr(const ChonkyMontgomery* ctx, u64* rp, const u64* ap, u64* temp) {
+	if (ctx -> digits != 0) {
+		__chonky_mont_mul(ctx, rp, ap, ap, temp);
+		return rp;
+	}
+
+	const u64 n = ctx -> size;
+	if (__chonky_limbs_sqr(temp, ap, n) == NULL) return NULL;
+	temp[2 * n] = 0;
+	__chonky_mont_redc(ctx, rp, temp);
+	return rp;
+}
+
+EXPORT_FUNCTION void dealloc_chonky_montgomery(ChonkyMontgomery* ctx) {
+	if (ctx == NULL) return;
+	if (ctx -> mod != NULL) dealloc_chonky_num(ctx -> mod);
+	if (ctx -> r2 != NULL) dealloc_chonky_num(ctx -> r2);
+	if (ctx -> mod_digits != NULL) __chonky_release(ctx -> is_pooled, ctx -> mod_digits);
+	__chonky_release(ctx -> is_pooled, ctx);
+	return;
+}
+
+EXPORT_FUNCTION ChonkyMontgomery* alloc_chonky_montgomery(const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 n = chonky_real_size_64(mod);
+	if (n == 0 || !((mod -> data_64)[0] & 1)) {
+		WARNING_LOG("Montgomery arithmetic requires an odd modulus.");
+		return NULL;
+	}
+
+	ChonkyMontgomery* ctx = __chonky_calloc(1, sizeof(ChonkyMontgomery));
+	if (ctx == NULL) {
+		WARNING_LOG("Failed to allocate montgomery context.");
+		return NULL;
+	}
+
+	ctx -> is_pooled = (__chonky_thread_pool != NULL);
+	ctx -> size = n;
+	ctx -> m_inv = __chonky_mont_inverse((mod -> data_64)[0]);
+	ctx -> mod = alloc_chonky_num(mod -> data, n * 8, 0);
+	ctx -> r2 = alloc_chonky_num(NULL, n * 8, 0);
+	if (n >= CHONKY_IFMA_MONT_THRESHOLD && __chonky_has_ifma()) {
+		ctx -> digits = CHONKY_IFMA_DIGITS(n);
+		ctx -> mod_digits = __chonky_calloc(CHONKY_IFMA_PADDED_DIGITS(n), sizeof(u64));
+	}
+
+	// R^2 mod m, with R^2 = 2^r2_bits
+	const u64 r2_bits = (ctx -> digits != 0) ? 2 * CHONKY_IFMA_DIGIT_BITS * ctx -> digits : 128 * n;
+	const u64 r2_size = r2_bits / 64 + 1;
+	u64* temp = __chonky_calloc(r2_size + CHONKY_DIVREM_TEMP_SIZE(r2_size, n), sizeof(u64));
+	if (ctx -> mod == NULL || ctx -> r2 == NULL || (ctx -> digits != 0 && ctx -> mod_digits == NULL) || temp == NULL) {
+		__chonky_free(temp);
+		dealloc_chonky_montgomery(ctx);
+		WARNING_LOG("Failed to allocate montgomery context buffers.");
+		return NULL;
+	}
+
+	if (ctx -> digits != 0) __chonky_ifma_from_limbs(ctx -> mod_digits, CHONKY_IFMA_PADDED_DIGITS(n), ctx -> mod -> data_64, n);
+
+	u64* r2_full = temp + CHONKY_DIVREM_TEMP_SIZE(r2_size, n);
+	r2_full[r2_size - 1] = 1ULL << (r2_bits % 64);
+	__chonky_limbs_divrem(NULL, ctx -> r2 -> data_64, r2_full, r2_size, ctx -> mod -> data_64, n, temp);
+	__chonky_trim(ctx -> r2, n);
+
+	__chonky_free(temp);
+
+	return ctx;
+}
+
+static u64* __chonky_pow_ops_mont_mul(const ChonkyPowOps* ops, u64* rp, const u64* ap, const u64* bp, u64* temp) {
+	__chonky_mont_mul((const ChonkyMontgomery*) ops -> ctx, rp, ap, bp, temp);
+	return rp;
+}
+
+static u64* __chonky_pow_ops_mont_sqr(const ChonkyPowOps* ops, u64* rp, const u64* ap, u64* temp) {
+	return __chonky_mont_sqr((const ChonkyMontgomery*) ops -> ctx, rp, ap, temp);
+}
+
+static ChonkyPowOps __chonky_montgomery_ops(const ChonkyMontgomery* ctx) {
+	const ChonkyPowOps ops = {
+		.mul = __chonky_pow_ops_mont_mul,
+		.sqr = __chonky_pow_ops_mont_sqr,
+		.ctx = ctx,
+		.size = ctx -> size,
+		.temp_size = __chonky_mont_temp_size(ctx)
+	};
+	return ops;
+}
+
+// NOTE: The base must not have more limbs than the modulus
+CHONKY_FAILABLE static BigNum* __chonky_pow_mod_montgomery(BigNum* res, const BigNum* num, const BigNum* exp, const ChonkyMontgomery* ctx) {
+	const u64 n = ctx -> size;
+	CHONKY_ASSERT(res -> size / 8 >= n);
+	CHONKY_ASSERT(chonky_real_size_64(num) <= n);
+	
+	const u64 temp_size = __chonky_mont_temp_size(ctx);
+	u64* temp = __chonky_calloc(temp_size + 3 * n, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate montgomery buffers.");
+		return NULL;
+	}
+
+	u64* base = temp + temp_size;
+	u64* acc = base + n;
+	u64* one = acc + n;
+
+	// Move both the base and 1 into Montgomery form
+	__chonky_limbs_copy(base, num -> data_64, chonky_real_size_64(num));
+	__chonky_mont_mul(ctx, base, base, ctx -> r2 -> data_64, temp);
+	one[0] = 1;
+	__chonky_mont_mul(ctx, acc, one, ctx -> r2 -> data_64, temp);
+
+	const ChonkyPowOps ops = __chonky_montgomery_ops(ctx);
+	if (__chonky_pow_window(&ops, acc, base, exp) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	// Leave the Montgomery form by multiplying by 1
+	__chonky_mont_mul(ctx, acc, acc, one, temp);
+	
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, acc, n);
+	__chonky_trim(res, n);
+
+	__chonky_free(temp);
+
+	return res;
+}
+
+/// -------------------------------
+///  Barrett Reduction
+/// -------------------------------
+// NOTE: The context stores the modulus in k limbs together with
+// mu = floor((B^2k - 1) / m) in k + 1 limbs, with B = 2^64, any non-zero
+// modulus is valid.
+EXPORT_STRUCTURE typedef struct ChonkyBarrett {
+	BigNum* mod;
+	BigNum* mu;
+	u64 size;
+	u8 is_pooled;
+} ChonkyBarrett;
+
+// NOTE: Size of the temp buffer required by __chonky_barrett_reduce
+#define CHONKY_BARRETT_TEMP_SIZE(k) (8 * (k) + 4)
+
+// Reduces a value of at most 2k limbs: q = ((x / B^(k-1)) * mu) / B^(k+1)
+// underestimates x / m by at most three, so r = x - q * m (mod B^(k+1)) only
+// needs a few final corrections.
+// NOTE: rp must have space for k limbs, and can alias xp
+CHONKY_FAILABLE static u64* __chonky_barrett_reduce_2k(const ChonkyBarrett* ctx, u64* rp, const u64* xp, const u64 xn, u64* temp) {
+	const u64 k = ctx -> size;
+	const u64* mp = ctx -> mod -> data_64;
+	CHONKY_ASSERT(xn <= 2 * k);
+
+	u64* x = temp;
+	u64* q2 = x + 2 * k;
+	u64* prod = q2 + 2 * k + 2;
+
+	__chonky_limbs_copy(x, xp, xn);
+	__chonky_limbs_zero(x + xn, 2 * k - xn);
+
+	if (__chonky_limbs_mul(q2, x + k - 1, k + 1, ctx -> mu -> data_64, k + 1) == NULL) return NULL;
+	if (__chonky_limbs_mul(prod, q2 + k + 1, k + 1, mp, k) == NULL) return NULL;
+
+	__chonky_limbs_sub(x, x, k + 1, prod, k + 1);
+	while (x[k] || __chonky_limbs_cmp(x, mp, k) >= 0) {
+		x[k] -= __chonky_limbs_sub(x, x, k, mp, k);
+	}
+
+	__chonky_limbs_copy(rp, x, k);
+
+	return rp;
+}
+
+// Reduces a value of any size, folding it k limbs at a time starting from the
+// most significant ones, as r * B^k + chunk always fits in 2k limbs.
+// NOTE: rp must have space for k limbs, and must not overlap xp
+CHONKY_FAILABLE static u64* __chonky_barrett_reduce(const ChonkyBarrett* ctx, u64* rp, const u64* xp, const u64 xn, u64* temp) {
+	const u64 k = ctx -> size;
+	if (xn <= 2 * k) return __chonky_barrett_reduce_2k(ctx, rp, xp, xn, temp);
+	
+	u64* window = temp + CHONKY_BARRETT_TEMP_SIZE(k) - 2 * k;
+	const u64 top_size = xn % k ? xn % k : k;
+	u64 pos = xn - top_size - k;
+	if (__chonky_barrett_reduce_2k(ctx, rp, xp + pos, top_size + k, temp) == NULL) return NULL;
+	
+	while (pos > 0) {
+		pos -= k;
+		__chonky_limbs_copy(window, xp + pos, k);
+		__chonky_limbs_copy(window + k, rp, k);
+		if (__chonky_barrett_reduce_2k(ctx, rp, window, 2 * k, temp) == NULL) return NULL;
+	}
+
+	return rp;
+}
+
+EXPORT_FUNCTION void dealloc_chonky_barrett(ChonkyBarrett* ctx) {
+	if (ctx == NULL) return;
+	if (ctx -> mod != NULL) dealloc_chonky_num(ctx -> mod);
+	if (ctx -> mu != NULL) dealloc_chonky_num(ctx -> mu);
+	__chonky_release(ctx -> is_pooled, ctx);
+	return;
+}
+
+EXPORT_FUNCTION ChonkyBarrett* alloc_chonky_barrett(const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 k = chonky_real_size_64(mod);
+	if (k == 0) {
+		WARNING_LOG("Barrett reduction requires a non-zero modulus.");
+		return NULL;
+	}
+
+	ChonkyBarrett* ctx = __chonky_calloc(1, sizeof(ChonkyBarrett));
+	if (ctx == NULL) {
+		WARNING_LOG("Failed to allocate barrett context.");
+		return NULL;
+	}
+
+	ctx -> is_pooled = (__chonky_thread_pool != NULL);
+	ctx -> size = k;
+	ctx -> mod = alloc_chonky_num(mod -> data, k * 8, 0);
+	ctx -> mu = alloc_chonky_num(NULL, (k + 1) * 8, 0);
+	u64* temp = __chonky_calloc(2 * k + CHONKY_DIVREM_TEMP_SIZE(2 * k, k), sizeof(u64));
+	if (ctx -> mod == NULL || ctx -> mu == NULL || temp == NULL) {
+		__chonky_free(temp);
+		dealloc_chonky_barrett(ctx);
+		WARNING_LOG("Failed to allocate barrett context buffers.");
+		return NULL;
+	}
+
+	// mu = floor((B^2k - 1) / m)
+	// NOTE: Using B^2k - 1 keeps mu within k + 1 limbs even when m = B^(k-1),
+	// it only differs when m divides B^2k, costing at most one more correction.
+	u64* num = temp + CHONKY_DIVREM_TEMP_SIZE(2 * k, k);
+	for (u64 i = 0; i < 2 * k; ++i) num[i] = ~0ULL;
+	__chonky_limbs_divrem(ctx -> mu -> data_64, NULL, num, 2 * k, ctx -> mod -> data_64, k, temp);
+	__chonky_trim(ctx -> mu, k + 1);
+
+	__chonky_free(temp);
+
+	return ctx;
+}
+
+static u64* __chonky_pow_ops_barrett_mul(const ChonkyPowOps* ops, u64* rp, const u64* ap, const u64* bp, u64* temp) {
+	const u64 k = ops -> size;
+	if (__chonky_limbs_mul(temp, ap, k, bp, k) == NULL) return NULL;
+	return __chonky_barrett_reduce_2k((const ChonkyBarrett*) ops -> ctx, rp, temp, 2 * k, temp + 2 * k);
+}
+
+static u64* __chonky_pow_ops_barrett_sqr(const ChonkyPowOps* ops, u64* rp, const u64* ap, u64* temp) {
+	const u64 k = ops -> size;
+	if (__chonky_limbs_sqr(temp, ap, k) == NULL) return NULL;
+	return __chonky_barrett_reduce_2k((const ChonkyBarrett*) ops -> ctx, rp, temp, 2 * k, temp + 2 * k);
+}
+
+static ChonkyPowOps __chonky_barrett_ops(const ChonkyBarrett* ctx) {
+	const ChonkyPowOps ops = {
+		.mul = __chonky_pow_ops_barrett_mul,
+		.sqr = __chonky_pow_ops_barrett_sqr,
+		.ctx = ctx,
+		.size = ctx -> size,
+		.temp_size = 2 * ctx -> size + CHONKY_BARRETT_TEMP_SIZE(ctx -> size)
+	};
+	return ops;
+}
+
+CHONKY_FAILABLE static BigNum* __chonky_pow_mod_barrett(BigNum* res, const BigNum* num, const BigNum* exp, const ChonkyBarrett* ctx) {
+	const u64 k = ctx -> size;
+	CHONKY_ASSERT(res -> size / 8 >= k);
+
+	const u64 temp_size = CHONKY_BARRETT_TEMP_SIZE(k);
+	u64* temp = __chonky_calloc(temp_size + 2 * k, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate barrett buffers.");
+		return NULL;
+	}
+
+	u64* base = temp + temp_size;
+	u64* acc = base + k;
+
+	const u64 one = 1;
+	if (__chonky_barrett_reduce(ctx, base, num -> data_64, MAX(chonky_real_size_64(num), 1), temp) == NULL ||
+		__chonky_barrett_reduce(ctx, acc, &one, 1, temp) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	const ChonkyPowOps ops = __chonky_barrett_ops(ctx);
+	if (__chonky_pow_window(&ops, acc, base, exp) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, acc, k);
+	__chonky_trim(res, k);
+
+	__chonky_free(temp);
+
+	return res;
+}
+
+CHONKY_FAILABLE static BigNum* __chonky_pow_mod(BigNum* res, const BigNum* num, const BigNum* exp, const BigNum* mod_base) {
+	// Odd moduli go through Montgomery, every other one through Barrett, so
+	// that no step requires a long division.
+	if ((mod_base -> data)[0] & 1 && chonky_real_size_64(num) <= chonky_real_size_64(mod_base)) {
+		ChonkyMontgomery* ctx = alloc_chonky_montgomery(mod_base);
+		if (ctx == NULL) return NULL;
+		BigNum* result = __chonky_pow_mod_montgomery(res, num, exp, ctx);
+		dealloc_chonky_montgomery(ctx);
+		return result;
+	}
+
+	ChonkyBarrett* ctx = alloc_chonky_barrett(mod_base);
+	if (ctx == NULL) return NULL;
+	BigNum* result = __chonky_pow_mod_barrett(res, num, exp, ctx);
+	dealloc_chonky_barrett(ctx);
+	
+	return result;
+}
+
+/// -------------------------------
+///  Pseudo-Mersenne Reduction
+/// -------------------------------
+// NOTE: The context stores the modulus m = 2^k - c, with k its bit size, in
+// n limbs together with c. Splitting x = hi * 2^k + lo, x = hi * c + lo mod m,
+// so each fold drops about k - bits(c) bits, and once x < 2^k < 2m a single
+// subtraction is left. With c of one or two limbs the fold is a
+// multiply-accumulate by each limb of c, with bigger ones a full product.
+// Moduli with c over k / 2 bits would need too many folds, so they are
+// reduced through Barrett instead.
+EXPORT_STRUCTURE typedef struct ChonkyMersenne {
+	BigNum* mod;
+	BigNum* c;
+	ChonkyBarrett* barrett;
+	u64 bits;
+	u64 size;
+	u64 c_size;
+	u8 is_pooled;
+} ChonkyMersenne;
+
+// NOTE: Size of the temp buffer required by __chonky_mersenne_reduce for xn limbs
+static inline u64 __chonky_mersenne_temp_size(const ChonkyMersenne* ctx, const u64 xn) {
+	if (ctx -> barrett != NULL) return CHONKY_BARRETT_TEMP_SIZE(ctx -> size);
+	return 3 * (MAX(xn, ctx -> size) + ctx -> c_size + 1);
+}
+
+// NOTE: rp must have space for n limbs, and must not overlap xp
+CHONKY_FAILABLE static u64* __chonky_mersenne_reduce(const ChonkyMersenne* ctx, u64* rp, const u64* xp, const u64 xn, u64* temp) {
+	if (ctx -> barrett != NULL) return __chonky_barrett_reduce(ctx -> barrett, rp, xp, xn, temp);
+	
+	const u64 n = ctx -> size;
+	const u64 cn = ctx -> c_size;
+	const u64* cp = ctx -> c -> data_64;
+	const u64 kw = ctx -> bits / 64;
+	const u8 kb = ctx -> bits % 64;
+
+	const u64 size = MAX(xn, n) + cn + 1;
+	u64* x = temp;
+	u64* hi = x + size;
+	__chonky_limbs_copy(x, xp, xn);
+	__chonky_limbs_zero(x + xn, size - xn);
+	
+	u64 x_size = __chonky_limbs_real_size(x, xn);
+	while (x_size > kw + 1 || (x_size == kw + 1 && (x[kw] >> kb) != 0)) {
+		const u64 hn = x_size - kw;
+		__chonky_limbs_rshift(hi, x + kw, hn, kb);
+		x[kw] &= (1ULL << kb) - 1;
+		__chonky_limbs_zero(x + kw + 1, hn - 1);
+
+		if (cn <= 2) {
+			for (u64 j = 0; j < cn; ++j) {
+				const u64 carry = __chonky_limbs_addmul_1(x + j, hi, hn, cp[j]);
+				__chonky_limbs_add_in(x + j + hn, size - j - hn, &carry, 1);
+			}
+		} else {
+			u64* prod = hi + hn;
+			if (__chonky_limbs_mul(prod, hi, hn, cp, cn) == NULL) return NULL;
+			__chonky_limbs_add_in(x, size, prod, hn + cn);
+		}
+
+		x_size = __chonky_limbs_real_size(x, size);
+	}
+
+	// x < 2^k < 2m, as c < 2^(k/2) < m
+	if (__chonky_limbs_cmp(x, ctx -> mod -> data_64, n) >= 0) __chonky_limbs_sub(x, x, n, ctx -> mod -> data_64, n);
+	__chonky_limbs_copy(rp, x, n);
+
+	return rp;
+}
+
+EXPORT_FUNCTION void dealloc_chonky_mersenne(ChonkyMersenne* ctx) {
+	if (ctx == NULL) return;
+	if (ctx -> mod != NULL) dealloc_chonky_num(ctx -> mod);
+	if (ctx -> c != NULL) dealloc_chonky_num(ctx -> c);
+	dealloc_chonky_barrett(ctx -> barrett);
+	__chonky_release(ctx -> is_pooled, ctx);
+	return;
+}
+
+EXPORT_FUNCTION ChonkyMersenne* alloc_chonky_mersenne(const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 n = chonky_real_size_64(mod);
+	if (n == 0) {
+		WARNING_LOG("Pseudo-mersenne reduction requires a non-zero modulus.");
+		return NULL;
+	}
+
+	ChonkyMersenne* ctx = __chonky_calloc(1, sizeof(ChonkyMersenne));
+	if (ctx == NULL) {
+		WARNING_LOG("Failed to allocate mersenne context.");
+		return NULL;
+	}
+
+	ctx -> is_pooled = (__chonky_thread_pool != NULL);
+	ctx -> size = n;
+	ctx -> bits = n * 64 - __builtin_clzll((mod -> data_64)[n - 1]);
+	ctx -> mod = alloc_chonky_num(mod -> data, n * 8, 0);
+	ctx -> c = alloc_chonky_num(NULL, n * 8, 0);
+	if (ctx -> mod == NULL || ctx -> c == NULL) {
+		dealloc_chonky_mersenne(ctx);
+		WARNING_LOG("Failed to allocate mersenne context buffers.");
+		return NULL;
+	}
+
+	// c = 2^k - m, computed as (0 - m) mod 2^k
+	u64* cp = ctx -> c -> data_64;
+	__chonky_limbs_sub(cp, cp, n, ctx -> mod -> data_64, n);
+	if (ctx -> bits % 64) cp[n - 1] &= (1ULL << (ctx -> bits % 64)) - 1;
+	__chonky_trim(ctx -> c, n);
+	ctx -> c_size = ctx -> c -> limbs;
+
+	if (chonky_bit_size(ctx -> c) > ctx -> bits / 2) {
+		ctx -> barrett = alloc_chonky_barrett(mod);
+		if (ctx -> barrett == NULL) {
+			dealloc_chonky_mersenne(ctx);
+			return NULL;
+		}
+	}
+
+	return ctx;
+}
+
+static u64* __chonky_pow_ops_mersenne_mul(const ChonkyPowOps* ops, u64* rp, const u64* ap, const u64* bp, u64* temp) {
+	const u64 n = ops -> size;
+	if (__chonky_limbs_mul(temp, ap, n, bp, n) == NULL) return NULL;
+	return __chonky_mersenne_reduce((const ChonkyMersenne*) ops -> ctx, rp, temp, 2 * n, temp + 2 * n);
+}
+
+static u64* __chonky_pow_ops_mersenne_sqr(const ChonkyPowOps* ops, u64* rp, const u64* ap, u64* temp) {
+	const u64 n = ops -> size;
+	if (__chonky_limbs_sqr(temp, ap, n) == NULL) return NULL;
+	return __chonky_mersenne_reduce((const ChonkyMersenne*) ops -> ctx, rp, temp, 2 * n, temp + 2 * n);
+}
+
+CHONKY_FAILABLE static BigNum* __chonky_pow_mod_mersenne(BigNum* res, const BigNum* num, const BigNum* exp, const ChonkyMersenne* ctx) {
+	const u64 n = ctx -> size;
+	CHONKY_ASSERT(res -> size / 8 >= n);
+
+	const u64 num_size = MAX(chonky_real_size_64(num), 1);
+	const u64 temp_size = MAX(2 * n + __chonky_mersenne_temp_size(ctx, 2 * n), __chonky_mersenne_temp_size(ctx, num_size));
+	u64* temp = __chonky_calloc(temp_size + 2 * n, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate mersenne buffers.");
+		return NULL;
+	}
+
+	u64* base = temp + temp_size;
+	u64* acc = base + n;
+
+	const u64 one = 1;
+	if (__chonky_mersenne_reduce(ctx, base, num -> data_64, num_size, temp) == NULL ||
+		__chonky_mersenne_reduce(ctx, acc, &one, 1, temp) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	const ChonkyPowOps ops = {
+		.mul = __chonky_pow_ops_mersenne_mul,
+		.sqr = __chonky_pow_ops_mersenne_sqr,
+		.ctx = ctx,
+		.size = n,
+		.temp_size = 2 * n + __chonky_mersenne_temp_size(ctx, 2 * n)
+	};
+
+	if (__chonky_pow_window(&ops, acc, base, exp) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, acc, n);
+	__chonky_trim(res, n);
+
+	__chonky_free(temp);
+
+	return res;
+}
+
+/// -------------------------------
+///  Fixed Base Exponentiation
+/// -------------------------------
+// NOTE: Lim-Lee comb over a fixed base g: the exponent (up to max_exp_bits)
+// is split in `window` rows of `stride` bits, each row is then split in
+// `tables` blocks of `sub_stride` bits. Every table stores the 2^window
+// products of g^(2^(s * stride)) selected by the bits of the index, raised to
+// 2^(j * sub_stride) for the j-th table, so that an evaluation costs
+// sub_stride - 1 squarings and about max_exp_bits / window multiplications.
+// The table takes tables * 2^window elements, trading memory for latency.
+#ifndef CHONKY_FIXED_BASE_WINDOW
+	#define CHONKY_FIXED_BASE_WINDOW 4
+#endif //CHONKY_FIXED_BASE_WINDOW
+
+#ifndef CHONKY_FIXED_BASE_TABLES
+	#define CHONKY_FIXED_BASE_TABLES 2
+#endif //CHONKY_FIXED_BASE_TABLES
+
+EXPORT_STRUCTURE typedef struct ChonkyFixedBase {
+	ChonkyMontgomery* mont;
+	ChonkyBarrett* barrett;
+	u64* table;
+	u64 size;
+	u64 max_exp_bits;
+	u64 window;
+	u64 tables;
+	u64 stride;
+	u64 sub_stride;
+	u8 is_pooled;
+} ChonkyFixedBase;
+
+static ChonkyPowOps __chonky_fixed_base_ops(const ChonkyFixedBase* ctx) {
+	if (ctx -> mont != NULL) return __chonky_montgomery_ops(ctx -> mont);
+	return __chonky_barrett_ops(ctx -> barrett);
+}
+
+EXPORT_FUNCTION void dealloc_chonky_fixed_base(ChonkyFixedBase* ctx) {
+	if (ctx == NULL) return;
+	dealloc_chonky_montgomery(ctx -> mont);
+	dealloc_chonky_barrett(ctx -> barrett);
+	if (ctx -> table != NULL) __chonky_release(ctx -> is_pooled, ctx -> table);
+	__chonky_release(ctx -> is_pooled, ctx);
+	return;
+}
+
+// NOTE: A window or tables count of zero selects the default value
+EXPORT_FUNCTION ChonkyFixedBase* alloc_chonky_fixed_base(const BigNum* base, const BigNum* mod, u64 max_exp_bits, u64 window, u64 tables) {
+	if (!IS_VALID_BIG_NUM(base) || !IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (is_chonky_zero((BigNum*) mod)) {
+		WARNING_LOG("The modulus must not be zero.");
+		return NULL;
+	}
+
+	if (window == 0) window = CHONKY_FIXED_BASE_WINDOW;
+	if (tables == 0) tables = CHONKY_FIXED_BASE_TABLES;
+	if (max_exp_bits == 0) max_exp_bits = 1;
+	if (window > 16) {
+		WARNING_LOG("Window too big, the table would take 2^%llu elements.", window);
+		return NULL;
+	}
+
+	ChonkyFixedBase* ctx = __chonky_calloc(1, sizeof(ChonkyFixedBase));
+	if (ctx == NULL) {
+		WARNING_LOG("Failed to allocate fixed base context.");
+		return NULL;
+	}
+
+	ctx -> is_pooled = (__chonky_thread_pool != NULL);
+	ctx -> max_exp_bits = max_exp_bits;
+	ctx -> window = window;
+	ctx -> stride = (max_exp_bits + window - 1) / window;
+	ctx -> tables = MIN(tables, ctx -> stride);
+	ctx -> sub_stride = (ctx -> stride + ctx -> tables - 1) / ctx -> tables;
+
+	// NOTE: The base is always reduced through Barrett, so that bases bigger
+	// than the modulus are supported as well.
+	ctx -> barrett = alloc_chonky_barrett(mod);
+	if (ctx -> barrett == NULL) {
+		dealloc_chonky_fixed_base(ctx);
+		return NULL;
+	}
+
+	if ((mod -> data)[0] & 1) {
+		ctx -> mont = alloc_chonky_montgomery(mod);
+		if (ctx -> mont == NULL) {
+			dealloc_chonky_fixed_base(ctx);
+			return NULL;
+		}
+	}
+
+	const u64 n = ctx -> barrett -> size;
+	const u64 entries = 1ULL << window;
+	const ChonkyPowOps ops = __chonky_fixed_base_ops(ctx);
+	ctx -> size = n;
+	ctx -> table = __chonky_calloc(ctx -> tables * entries * n, sizeof(u64));
+	u64* temp = __chonky_calloc(ops.temp_size + CHONKY_BARRETT_TEMP_SIZE(n) + window * n + n, sizeof(u64));
+	if (ctx -> table == NULL || temp == NULL) {
+		__chonky_free(temp);
+		dealloc_chonky_fixed_base(ctx);
+		WARNING_LOG("Failed to allocate fixed base table.");
+		return NULL;
+	}
+
+	u64* rows = temp + ops.temp_size + CHONKY_BARRETT_TEMP_SIZE(n);
+	u64* one = rows + window * n;
+
+	// rows[s] = g^(2^(s * stride)), in the representation of the backend
+	const u64 one_limb = 1;
+	bool is_failed = (__chonky_barrett_reduce(ctx -> barrett, rows, base -> data_64, MAX(chonky_real_size_64(base), 1), temp) == NULL);
+	is_failed |= (__chonky_barrett_reduce(ctx -> barrett, one, &one_limb, 1, temp) == NULL);
+	if (ctx -> mont != NULL) {
+		__chonky_mont_mul(ctx -> mont, rows, rows, ctx -> mont -> r2 -> data_64, temp);
+		__chonky_mont_mul(ctx -> mont, one, one, ctx -> mont -> r2 -> data_64, temp);
+	}
+
+	for (u64 s = 1; !is_failed && s < window; ++s) {
+		__chonky_limbs_copy(rows + s * n, rows + (s - 1) * n, n);
+		for (u64 i = 0; !is_failed && i < ctx -> stride; ++i) {
+			is_failed = (ops.sqr(&ops, rows + s * n, rows + s * n, temp) == NULL);
+		}
+	}
+
+	// First table: each entry adds the highest row selected by the index to
+	// the entry without that bit, the others are the previous squared.
+	u64* table = ctx -> table;
+	__chonky_limbs_copy(table, one, n);
+	for (u64 i = 1; !is_failed && i < entries; ++i) {
+		const u8 top = 63 - __builtin_clzll(i);
+		const u64 prev = i ^ (1ULL << top);
+		if (prev == 0) __chonky_limbs_copy(table + i * n, rows + top * n, n);
+		else is_failed = (ops.mul(&ops, table + i * n, table + prev * n, rows + top * n, temp) == NULL);
+	}
+
+	for (u64 j = 1; !is_failed && j < ctx -> tables; ++j) {
+		u64* sub_table = ctx -> table + j * entries * n;
+		for (u64 i = 0; !is_failed && i < entries; ++i) {
+			__chonky_limbs_copy(sub_table + i * n, sub_table - entries * n + i * n, n);
+			for (u64 k = 0; !is_failed && k < ctx -> sub_stride; ++k) {
+				is_failed = (ops.sqr(&ops, sub_table + i * n, sub_table + i * n, temp) == NULL);
+			}
+		}
+	}
+
+	__chonky_free(temp);
+
+	if (is_failed) {
+		dealloc_chonky_fixed_base(ctx);
+		return NULL;
+	}
+
+	return ctx;
+}
+
+CHONKY_FAILABLE static BigNum* __chonky_fixed_base_pow_mod(BigNum* res, const BigNum* exp, const ChonkyFixedBase* ctx) {
+	const u64 n = ctx -> size;
+	const u64 entries = 1ULL << ctx -> window;
+	const u64 exp_bit_size = is_chonky_zero((BigNum*) exp) ? 0 : chonky_bit_size(exp);
+	CHONKY_ASSERT(exp_bit_size <= ctx -> max_exp_bits);
+	CHONKY_ASSERT(res -> size / 8 >= n);
+
+	const ChonkyPowOps ops = __chonky_fixed_base_ops(ctx);
+	u64* temp = __chonky_calloc(ops.temp_size + 2 * n, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate fixed base buffers.");
+		return NULL;
+	}
+
+	u64* acc = temp + ops.temp_size;
+	
+	// The first entry of the table is always one
+	__chonky_limbs_copy(acc, ctx -> table, n);
+
+	bool is_one = TRUE;
+	for (s64 k = ctx -> sub_stride - 1; k >= 0; --k) {
+		if (!is_one && ops.sqr(&ops, acc, acc, temp) == NULL) {
+			__chonky_free(temp);
+			return NULL;
+		}
+
+		for (s64 j = ctx -> tables - 1; j >= 0; --j) {
+			const u64 col = j * ctx -> sub_stride + k;
+			if (col >= ctx -> stride) continue;
+
+			u64 index = 0;
+			for (u64 s = 0; s < ctx -> window; ++s) {
+				const u64 bit = s * ctx -> stride + col;
+				if (bit < exp_bit_size) index |= EXP_BIT(exp, bit) << s;
+			}
+			
+			if (index == 0) continue;
+
+			const u64* entry = ctx -> table + (j * entries + index) * n;
+			if (is_one) {
+				__chonky_limbs_copy(acc, entry, n);
+				is_one = FALSE;
+			} else if (ops.mul(&ops, acc, acc, entry, temp) == NULL) {
+				__chonky_free(temp);
+				return NULL;
+			}
+		}
+	}
+
+	// Leave the Montgomery form by multiplying by 1
+	if (ctx -> mont != NULL) {
+		u64* one = acc + n;
+		one[0] = 1;
+		__chonky_mont_mul(ctx -> mont, acc, acc, one, temp);
+	}
+
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, acc, n);
+	__chonky_trim(res, n);
+
+	__chonky_free(temp);
+
+	return res;
+}
+
+/// -------------------------------
+///  CRT Exponentiation
+/// -------------------------------
+// NOTE: With n = p * q and p, q coprime, x^d mod n is recovered from the two
+// half-size exponentiations m1 = x^dp mod p and m2 = x^dq mod q through
+// Garner's recombination m = m2 + q * (qinv * (m1 - m2) mod p), as each half
+// costs about an eighth of the full one. The halves run on two workers when
+// started and p spans at least CHONKY_CRT_PARALLEL_THRESHOLD limbs.
+#ifndef CHONKY_CRT_PARALLEL_THRESHOLD
+	#define CHONKY_CRT_PARALLEL_THRESHOLD 8
+#endif //CHONKY_CRT_PARALLEL_THRESHOLD
+
+// NOTE: qinv_r keeps q^-1 mod p in Montgomery form, so that a single
+// multiplication by it yields qinv * (m1 - m2) mod p.
+EXPORT_STRUCTURE typedef struct ChonkyCrt {
+	ChonkyMontgomery* mont_p;
+	ChonkyMontgomery* mont_q;
+	BigNum* dp;
+	BigNum* dq;
+	BigNum* qinv_r;
+	u8 is_pooled;
+} ChonkyCrt;
+
+typedef struct ChonkyCrtHalf {
+	BigNum* res;
+	const BigNum* num;
+	const BigNum* exp;
+	const ChonkyMontgomery* ctx;
+} ChonkyCrtHalf;
+
+EXPORT_FUNCTION void dealloc_chonky_crt(ChonkyCrt* ctx) {
+	if (ctx == NULL) return;
+	dealloc_chonky_montgomery(ctx -> mont_p);
+	dealloc_chonky_montgomery(ctx -> mont_q);
+	if (ctx -> dp != NULL) dealloc_chonky_num(ctx -> dp);
+	if (ctx -> dq != NULL) dealloc_chonky_num(ctx -> dq);
+	if (ctx -> qinv_r != NULL) dealloc_chonky_num(ctx -> qinv_r);
+	__chonky_release(ctx -> is_pooled, ctx);
+	return;
+}
+
+// NOTE: p and q must be odd, greater than one and coprime, with qinv = q^-1 mod p
+EXPORT_FUNCTION ChonkyCrt* alloc_chonky_crt(const BigNum* p, const BigNum* q, const BigNum* dp, const BigNum* dq, const BigNum* qinv) {
+	if (!IS_VALID_BIG_NUM(p) || !IS_VALID_BIG_NUM(q) || !IS_VALID_BIG_NUM(dp) || !IS_VALID_BIG_NUM(dq) || !IS_VALID_BIG_NUM(qinv)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (chonky_bit_size(p) < 2 || chonky_bit_size(q) < 2) {
+		WARNING_LOG("The factors must be greater than one.");
+		return NULL;
+	}
+
+	ChonkyCrt* ctx = __chonky_calloc(1, sizeof(ChonkyCrt));
+	if (ctx == NULL) {
+		WARNING_LOG("Failed to allocate crt context.");
+		return NULL;
+	}
+
+	ctx -> is_pooled = (__chonky_thread_pool != NULL);
+	ctx -> mont_p = alloc_chonky_montgomery(p);
+	ctx -> mont_q = alloc_chonky_montgomery(q);
+	if (ctx -> mont_p == NULL || ctx -> mont_q == NULL) {
+		dealloc_chonky_crt(ctx);
+		return NULL;
+	}
+
+	const u64 pn = ctx -> mont_p -> size;
+	ctx -> dp = dup_chonky_num(dp);
+	ctx -> dq = dup_chonky_num(dq);
+	ctx -> qinv_r = alloc_chonky_num(NULL, pn * 8, 0);
+	u64* temp = __chonky_calloc(__chonky_mont_temp_size(ctx -> mont_p), sizeof(u64));
+	if (ctx -> dp == NULL || ctx -> dq == NULL || ctx -> qinv_r == NULL || temp == NULL) {
+		__chonky_free(temp);
+		dealloc_chonky_crt(ctx);
+		WARNING_LOG("Failed to allocate crt context buffers.");
+		return NULL;
+	}
+
+	if (__chonky_mod(ctx -> qinv_r, qinv, ctx -> mont_p -> mod) == NULL) {
+		__chonky_free(temp);
+		dealloc_chonky_crt(ctx);
+		return NULL;
+	}
+
+	u64* qinv_p = ctx -> qinv_r -> data_64;
+	__chonky_mont_mul(ctx -> mont_p, qinv_p, qinv_p, ctx -> mont_p -> r2 -> data_64, temp);
+	__chonky_trim(ctx -> qinv_r, pn);
+
+	__chonky_free(temp);
+
+	return ctx;
+}
+
+// Derives dp = d mod (p - 1), dq = d mod (q - 1) and qinv = q^-1 mod p
+EXPORT_FUNCTION ChonkyCrt* alloc_chonky_crt_from_exp(const BigNum* p, const BigNum* q, const BigNum* d) {
+	if (!IS_VALID_BIG_NUM(p) || !IS_VALID_BIG_NUM(q) || !IS_VALID_BIG_NUM(d)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (chonky_bit_size(p) < 2 || chonky_bit_size(q) < 2 || !((p -> data_64)[0] & 1) || !((q -> data_64)[0] & 1)) {
+		WARNING_LOG("The factors must be odd and greater than one.");
+		return NULL;
+	}
+
+	const u64 pn = chonky_real_size_64(p);
+	const u64 qn = chonky_real_size_64(q);
+	BigNum* p_1 = dup_chonky_num(p);
+	BigNum* q_1 = dup_chonky_num(q);
+	BigNum* dp = alloc_chonky_num(NULL, pn * 8, 0);
+	BigNum* dq = alloc_chonky_num(NULL, qn * 8, 0);
+	BigNum* qinv = alloc_chonky_num(NULL, pn * 8, 0);
+	if (p_1 == NULL || q_1 == NULL || dp == NULL || dq == NULL || qinv == NULL) {
+		if (p_1 != NULL) dealloc_chonky_num(p_1);
+		if (q_1 != NULL) dealloc_chonky_num(q_1);
+		if (dp != NULL) dealloc_chonky_num(dp);
+		if (dq != NULL) dealloc_chonky_num(dq);
+		if (qinv != NULL) dealloc_chonky_num(qinv);
+		WARNING_LOG("Failed to allocate crt parameters.");
+		return NULL;
+	}
+
+	// Both factors are odd, so clearing the lowest bit subtracts one
+	(p_1 -> data_64)[0] &= ~1ULL;
+	(q_1 -> data_64)[0] &= ~1ULL;
+	p_1 -> sign = 0, q_1 -> sign = 0;
+
+	ChonkyCrt* ctx = NULL;
+	if (__chonky_mod(dp, d, p_1) != NULL && __chonky_mod(dq, d, q_1) != NULL && __chonky_invert(qinv, q, p) != NULL) {
+		ctx = alloc_chonky_crt(p, q, dp, dq, qinv);
+	}
+
+	DEALLOC_CHONKY_NUMS(p_1, q_1, dp, dq, qinv);
+
+	return ctx;
+}
+
+static bool __chonky_crt_half_run(void* arg) {
+	ChonkyCrtHalf* half = (ChonkyCrtHalf*) arg;
+	if (__chonky_mod(half -> res, half -> num, half -> ctx -> mod) == NULL) return FALSE;
+	return (__chonky_pow_mod_montgomery(half -> res, half -> res, half -> exp, half -> ctx) != NULL);
+}
+
+// NOTE: res must have space for the limbs of p plus the ones of q, it can alias num
+CHONKY_FAILABLE static BigNum* __chonky_pow_mod_crt(BigNum* res, const BigNum* num, const ChonkyCrt* ctx) {
+	const u64 pn = ctx -> mont_p -> size;
+	const u64 qn = ctx -> mont_q -> size;
+	CHONKY_ASSERT(res -> size / 8 >= pn + qn);
+
+	const u64 temp_size = __chonky_mont_temp_size(ctx -> mont_p);
+	BigNum* m1 = alloc_chonky_num(NULL, pn * 8, 0);
+	BigNum* m2 = alloc_chonky_num(NULL, qn * 8, 0);
+	BigNum* m2p = alloc_chonky_num(NULL, pn * 8, 0);
+	u64* temp = __chonky_calloc(temp_size + pn, sizeof(u64));
+	if (m1 == NULL || m2 == NULL || m2p == NULL || temp == NULL) {
+		if (m1 != NULL) dealloc_chonky_num(m1);
+		if (m2 != NULL) dealloc_chonky_num(m2);
+		if (m2p != NULL) dealloc_chonky_num(m2p);
+		__chonky_free(temp);
+		WARNING_LOG("Failed to allocate crt buffers.");
+		return NULL;
+	}
+
+	ChonkyCrtHalf halves[2] = {
+		{ .res = m1, .num = num, .exp = ctx -> dp, .ctx = ctx -> mont_p },
+		{ .res = m2, .num = num, .exp = ctx -> dq, .ctx = ctx -> mont_q }
+	};
+	ChonkyTask tasks[2] = {
+		{ .run = __chonky_crt_half_run, .arg = halves },
+		{ .run = __chonky_crt_half_run, .arg = halves + 1 }
+	};
+
+	// The halves are way costlier than the multiplications the workers are
+	// tuned for, so they are shared as soon as p reaches the crt threshold.
+	const u64 size = (pn >= CHONKY_CRT_PARALLEL_THRESHOLD) ? CHONKY_PARALLEL_THRESHOLD : 0;
+	if (!__chonky_tasks_run(tasks, 2, size) || __chonky_mod(m2p, m2, ctx -> mont_p -> mod) == NULL) {
+		DEALLOC_CHONKY_NUMS(m1, m2, m2p);
+		__chonky_free(temp);
+		return NULL;
+	}
+
+	// h = qinv * (m1 - m2) mod p
+	u64* hp = temp + temp_size;
+	const u64* pp = ctx -> mont_p -> mod -> data_64;
+	if (__chonky_limbs_sub(hp, m1 -> data_64, pn, m2p -> data_64, pn)) __chonky_limbs_add(hp, hp, pn, pp, pn);
+	__chonky_mont_mul(ctx -> mont_p, hp, hp, ctx -> qinv_r -> data_64, temp);
+
+	// res = m2 + h * q, which is below p * q
+	const u64 prev_limbs = res -> limbs;
+	if (__chonky_limbs_mul(res -> data_64, hp, pn, ctx -> mont_q -> mod -> data_64, qn) == NULL) {
+		DEALLOC_CHONKY_NUMS(m1, m2, m2p);
+		__chonky_free(temp);
+		return NULL;
+	}
+	__chonky_limbs_add_in(res -> data_64, pn + qn, m2 -> data_64, qn);
+
+	// Clear what is left of the previous value
+	if (prev_limbs > pn + qn) __chonky_limbs_zero(res -> data_64 + pn + qn, prev_limbs - pn - qn);
+	__chonky_trim(res, pn + qn);
+
+	DEALLOC_CHONKY_NUMS(m1, m2, m2p);
+	__chonky_free(temp);
+
+	return res;
+}
+
+/// -------------------------------
+///  Multi-Exponentiation
+/// -------------------------------
+// NOTE: The product of the powers base_j^exp_j shares a single chain of
+// squarings among all the bases. Up to CHONKY_PIPPENGER_THRESHOLD bases,
+// Straus' interleaved sliding windows keep the odd powers of each base, so
+// that every window costs a multiplication as in the single exponentiation.
+// Past it, Pippenger's buckets split the exponents in digits of c bits: at
+// each digit position every base goes into the bucket of its digit, then the
+// buckets are raised to their digit through two running products, in about
+// 2^(c + 1) multiplications, so that no table grows with the count.
+#ifndef CHONKY_PIPPENGER_THRESHOLD
+	#define CHONKY_PIPPENGER_THRESHOLD 64
+#endif //CHONKY_PIPPENGER_THRESHOLD
+
+#ifndef CHONKY_PIPPENGER_MAX_DIGIT_BITS
+	#define CHONKY_PIPPENGER_MAX_DIGIT_BITS 16
+#endif //CHONKY_PIPPENGER_MAX_DIGIT_BITS
+
+typedef struct ChonkyStrausBase {
+	const BigNum* exp;
+	u64* table;
+	u64 bit_size;
+	s64 low;
+	u64 value;
+	u8 window;
+} ChonkyStrausBase;
+
+// acc = acc * power, where a still unset acc (is_one) takes a copy of power instead
+CHONKY_FAILABLE static u64* __chonky_multi_pow_acc(const ChonkyPowOps* ops, u64* acc, const u64* power, bool* is_one, u64* temp) {
+	if (*is_one) {
+		__chonky_limbs_copy(acc, power, ops -> size);
+		*is_one = FALSE;
+		return acc;
+	}
+	return ops -> mul(ops, acc, acc, power, temp);
+}
+
+// acc = prod bases[j]^exps[j], bases holding count elements in the representation
+// of ops, and acc the representation of one (returned as is when all exps are 0).
+CHONKY_FAILABLE static u64* __chonky_multi_pow_straus(const ChonkyPowOps* ops, u64* acc, const u64* bases, BigNum** exps, const u64 count) {
+	const u64 n = ops -> size;
+	ChonkyStrausBase* states = __chonky_calloc(count, sizeof(ChonkyStrausBase));
+	if (states == NULL) {
+		WARNING_LOG("Failed to allocate the straus states.");
+		return NULL;
+	}
+
+	u64 max_bit_size = 0;
+	u64 table_size = 0;
+	for (u64 j = 0; j < count; ++j) {
+		states[j].exp = exps[j];
+		states[j].bit_size = is_chonky_zero(exps[j]) ? 0 : chonky_bit_size(exps[j]);
+		states[j].window = __chonky_window_size(states[j].bit_size);
+		states[j].low = -1;
+		max_bit_size = MAX(max_bit_size, states[j].bit_size);
+		if (states[j].bit_size != 0) table_size += 1ULL << (states[j].window - 1);
+	}
+
+	u64* temp = __chonky_calloc(ops -> temp_size + (table_size + 1) * n, sizeof(u64));
+	if (temp == NULL) {
+		__chonky_free(states);
+		WARNING_LOG("Failed to allocate the straus tables.");
+		return NULL;
+	}
+
+	// table_j[i] = base_j^(2i + 1)
+	u64* table = temp + ops -> temp_size;
+	u64* base_sqr = table + table_size * n;
+	bool is_failed = FALSE;
+	for (u64 j = 0; !is_failed && j < count; ++j) {
+		if (states[j].bit_size == 0) continue;
+
+		const u64 entries = 1ULL << (states[j].window - 1);
+		states[j].table = table;
+		__chonky_limbs_copy(table, bases + j * n, n);
+		if (entries > 1) is_failed = (ops -> sqr(ops, base_sqr, bases + j * n, temp) == NULL);
+		for (u64 i = 1; !is_failed && i < entries; ++i) {
+			is_failed = (ops -> mul(ops, table + i * n, table + (i - 1) * n, base_sqr, temp) == NULL);
+		}
+		table += entries * n;
+	}
+
+	// Every base opens its window at its first set bit not yet covered, and
+	// multiplies the power selected by it once the squarings reach its end.
+	bool is_one = TRUE;
+	for (s64 i = max_bit_size - 1; !is_failed && i >= 0; --i) {
+		if (!is_one) is_failed = (ops -> sqr(ops, acc, acc, temp) == NULL);
+
+		for (u64 j = 0; !is_failed && j < count; ++j) {
+			ChonkyStrausBase* state = states + j;
+			if (state -> low < 0 && (u64) i < state -> bit_size && EXP_BIT(state -> exp, i)) {
+				s64 low = MAX(i - state -> window + 1, 0);
+				while (!EXP_BIT(state -> exp, low)) low++;
+				
+				state -> value = 0;
+				for (s64 k = i; k >= low; --k) state -> value = (state -> value << 1) | EXP_BIT(state -> exp, k);
+				state -> low = low;
+			}
+
+			if (state -> low != i) continue;
+			
+			state -> low = -1;
+			is_failed = (__chonky_multi_pow_acc(ops, acc, state -> table + ((state -> value - 1) / 2) * n, &is_one, temp) == NULL);
+		}
+	}
+
+	__chonky_free(temp);
+	__chonky_free(states);
+
+	return is_failed ? NULL : acc;
+}
+
+// Digit size minimizing the multiplications of the buckets, as each of the
+// ceil(bits / c) positions takes count of them plus 2^(c + 1) to combine.
+static u8 __chonky_pippenger_digit_bits(const u64 count, const u64 bit_size) {
+	u8 best = 1;
+	u64 best_cost = ~0ULL;
+	for (u8 c = 1; c <= CHONKY_PIPPENGER_MAX_DIGIT_BITS; ++c) {
+		const u64 cost = ((bit_size + c - 1) / c) * (count + (2ULL << c));
+		if (cost < best_cost) best = c, best_cost = cost;
+	}
+	return best;
+}
+
+// Same as __chonky_multi_pow_straus, through Pippenger's buckets
+CHONKY_FAILABLE static u64* __chonky_multi_pow_pippenger(const ChonkyPowOps* ops, u64* acc, const u64* bases, BigNum** exps, const u64 count) {
+	const u64 n = ops -> size;
+	u64 max_bit_size = 0;
+	for (u64 j = 0; j < count; ++j) {
+		if (!is_chonky_zero(exps[j])) max_bit_size = MAX(max_bit_size, chonky_bit_size(exps[j]));
+	}
+	if (max_bit_size == 0) return acc;
+
+	const u8 c = __chonky_pippenger_digit_bits(count, max_bit_size);
+	const u64 mask = (1ULL << c) - 1;
+	const u64 positions = (max_bit_size + c - 1) / c;
+
+	// Buckets 1 to 2^c - 1 (the d-th at d - 1), followed by the two running products
+	u64* temp = __chonky_calloc(ops -> temp_size + (mask + 2) * n, sizeof(u64));
+	bool* is_empty = __chonky_calloc(mask + 1, sizeof(bool));
+	if (temp == NULL || is_empty == NULL) {
+		__chonky_free(temp);
+		__chonky_free(is_empty);
+		WARNING_LOG("Failed to allocate the pippenger buckets.");
+		return NULL;
+	}
+
+	u64* buckets = temp + ops -> temp_size;
+	u64* run = buckets + mask * n;
+	u64* sum = run + n;
+
+	bool is_one = TRUE;
+	bool is_failed = FALSE;
+	for (s64 t = positions - 1; !is_failed && t >= 0; --t) {
+		for (u8 k = 0; !is_one && !is_failed && k < c; ++k) is_failed = (ops -> sqr(ops, acc, acc, temp) == NULL);
+
+		for (u64 d = 1; d <= mask; ++d) is_empty[d] = TRUE;
+		for (u64 j = 0; !is_failed && j < count; ++j) {
+			const u64 d = __chonky_limbs_bits_at(exps[j] -> data_64, exps[j] -> limbs, t * c) & mask;
+			if (d != 0) is_failed = (__chonky_multi_pow_acc(ops, buckets + (d - 1) * n, bases + j * n, is_empty + d, temp) == NULL);
+		}
+
+		// sum = prod_d bucket_d^d = prod_d (prod_{e >= d} bucket_e)
+		bool is_run_one = TRUE;
+		bool is_sum_one = TRUE;
+		for (u64 d = mask; !is_failed && d > 0; --d) {
+			if (!is_empty[d]) is_failed = (__chonky_multi_pow_acc(ops, run, buckets + (d - 1) * n, &is_run_one, temp) == NULL);
+			if (!is_failed && !is_run_one) is_failed = (__chonky_multi_pow_acc(ops, sum, run, &is_sum_one, temp) == NULL);
+		}
+
+		if (!is_failed && !is_sum_one) is_failed = (__chonky_multi_pow_acc(ops, acc, sum, &is_one, temp) == NULL);
+	}
+
+	__chonky_free(temp);
+	__chonky_free(is_empty);
+
+	return is_failed ? NULL : acc;
+}
+
+// res = prod nums[j]^exps[j] mod mod_base, through Montgomery for odd moduli
+// and Barrett for the others, as the single exponentiation.
+// NOTE: res must have space for the limbs of the modulus, it can alias the operands
+CHONKY_FAILABLE static BigNum* __chonky_multi_pow_mod(BigNum* res, BigNum** nums, BigNum** exps, const u64 count, const BigNum* mod_base) {
+	ChonkyMontgomery* mont = NULL;
+	ChonkyBarrett* barrett = NULL;
+	if ((mod_base -> data)[0] & 1) mont = alloc_chonky_montgomery(mod_base);
+	else barrett = alloc_chonky_barrett(mod_base);
+	if (mont == NULL && barrett == NULL) return NULL;
+
+	const ChonkyPowOps ops = (mont != NULL) ? __chonky_montgomery_ops(mont) : __chonky_barrett_ops(barrett);
+	const BigNum* mod = (mont != NULL) ? mont -> mod : barrett -> mod;
+	const u64 n = ops.size;
+	CHONKY_ASSERT(res -> size / 8 >= n);
+
+	const u64 temp_size = MAX(ops.temp_size, CHONKY_BARRETT_TEMP_SIZE(n));
+	u64* temp = __chonky_calloc(temp_size + (count + 2) * n, sizeof(u64));
+	if (temp == NULL) {
+		dealloc_chonky_montgomery(mont);
+		dealloc_chonky_barrett(barrett);
+		WARNING_LOG("Failed to allocate multi-exponentiation buffers.");
+		return NULL;
+	}
+
+	u64* bases = temp + temp_size;
+	u64* acc = bases + count * n;
+	u64* one = acc + n;
+	one[0] = 1;
+
+	// Reduce the bases and move them, together with 1, into the representation
+	bool is_failed = FALSE;
+	for (u64 j = 0; !is_failed && j < count; ++j) {
+		BigNum base = POS_STATIC_BIG_NUM(bases + j * n, n * 8);
+		is_failed = (__chonky_mod(&base, nums[j], mod) == NULL);
+		if (!is_failed && mont != NULL) __chonky_mont_mul(mont, bases + j * n, bases + j * n, mont -> r2 -> data_64, temp);
+	}
+
+	if (mont != NULL) __chonky_mont_mul(mont, acc, one, mont -> r2 -> data_64, temp);
+	else is_failed |= (__chonky_barrett_reduce(barrett, acc, one, 1, temp) == NULL);
+
+	if (!is_failed && count <= CHONKY_PIPPENGER_THRESHOLD) is_failed = (__chonky_multi_pow_straus(&ops, acc, bases, exps, count) == NULL);
+	else if (!is_failed) is_failed = (__chonky_multi_pow_pippenger(&ops, acc, bases, exps, count) == NULL);
+
+	// Leave the Montgomery form by multiplying by 1
+	if (!is_failed && mont != NULL) __chonky_mont_mul(mont, acc, acc, one, temp);
+
+	if (!is_failed) {
+		__chonky_limbs_zero(res -> data_64, res -> size / 8);
+		__chonky_limbs_copy(res -> data_64, acc, n);
+		__chonky_trim(res, n);
+	}
+
+	__chonky_free(temp);
+	dealloc_chonky_montgomery(mont);
+	dealloc_chonky_barrett(barrett);
+
+	return is_failed ? NULL : res;
+}
+
+/// -------------------------------
+///  Primality Testing
+/// -------------------------------
+#include <sys/random.h>
+
+// NOTE: Numbers are first trial divided by the odd primes of a table built
+// once, grouped in products fitting a limb so that each group costs a single
+// pass over the limbs. The survivors go through Baillie-PSW, a Miller-Rabin
+// round to base 2 followed by a strong Lucas test with Selfridge's
+// parameters, plus any Miller-Rabin round over random bases, all of them
+// sharing one Montgomery context. Prime generation sieves CHONKY_SIEVE_SIZE
+// odd candidates at a time against the same table, moving the residues of
+// the start of the interval along with it, so that most candidates are
+// discarded without any exponentiation.
+#ifndef CHONKY_SIEVE_PRIMES
+	#define CHONKY_SIEVE_PRIMES 2048
+#endif //CHONKY_SIEVE_PRIMES
+
+#ifndef CHONKY_SIEVE_SIZE
+	#define CHONKY_SIEVE_SIZE 4096
+#endif //CHONKY_SIEVE_SIZE
+
+typedef struct ChonkySmallPrimes {
+	u32 primes[CHONKY_SIEVE_PRIMES];
+	u64 products[CHONKY_SIEVE_PRIMES];
+	u32 group_ends[CHONKY_SIEVE_PRIMES];
+	u32 groups;
+} ChonkySmallPrimes;
+
+static ChonkySmallPrimes __chonky_small_primes = {0};
+static pthread_once_t __chonky_small_primes_once = PTHREAD_ONCE_INIT;
+
+static void __chonky_small_primes_init(void) {
+	ChonkySmallPrimes* table = &__chonky_small_primes;
+	u32 count = 0;
+	for (u32 c = 3; count < CHONKY_SIEVE_PRIMES; c += 2) {
+		bool is_prime = TRUE;
+		for (u32 i = 0; is_prime && i < count && table -> primes[i] * table -> primes[i] <= c; ++i) is_prime = (c % table -> primes[i] != 0);
+		if (is_prime) table -> primes[count++] = c;
+	}
+
+	// Consecutive primes are grouped for as long as their product fits a limb
+	u64 product = 1;
+	for (u32 i = 0; i < CHONKY_SIEVE_PRIMES; ++i) {
+		const u64 p = table -> primes[i];
+		if (product > ~0ULL / p) {
+			table -> products[table -> groups] = product;
+			table -> group_ends[table -> groups++] = i;
+			product = 1;
+		}
+		product *= p;
+	}
+
+	table -> products[table -> groups] = product;
+	table -> group_ends[table -> groups++] = CHONKY_SIEVE_PRIMES;
+
+	return;
+}
+
+// ap mod d, dividing ap << shift by the normalized d << shift through its reciprocal
+static u64 __chonky_limbs_mod_1(const u64* ap, const u64 n, const u64 d) {
+	if (n == 0) return 0;
+
+	const u8 shift = __builtin_clzll(d);
+	const u64 dn = d << shift;
+	const u64 v = __chonky_limb_reciprocal(dn);
+	u64 r = (ap[n - 1] >> 1) >> (63 - shift);
+	for (s64 i = n - 1; i >= 0; --i) {
+		const u64 u0 = (ap[i] << shift) | ((i > 0) ? (ap[i - 1] >> 1) >> (63 - shift) : 0);
+		__chonky_limb_div_2by1(&r, r, u0, dn, v);
+	}
+
+	return r >> shift;
+}
+
+// residues[i] = ap mod primes[i], for each of the small primes
+static void __chonky_small_residues(u32* residues, const u64* ap, const u64 n) {
+	const ChonkySmallPrimes* table = &__chonky_small_primes;
+	u32 i = 0;
+	for (u32 g = 0; g < table -> groups; ++g) {
+		const u64 r = __chonky_limbs_mod_1(ap, n, table -> products[g]);
+		for (; i < table -> group_ends[g]; ++i) residues[i] = r % table -> primes[i];
+	}
+	return;
+}
+
+// Fills buf with size bytes from the system random source
+static bool __chonky_random_bytes(void* buf, const u64 size) {
+	u64 filled = 0;
+	while (filled < size) {
+		const ssize_t cnt = getrandom((u8*) buf + filled, size - filled, 0);
+		if (cnt <= 0) {
+			WARNING_LOG("Failed to read from the system random source.");
+			return FALSE;
+		}
+		filled += cnt;
+	}
+	return TRUE;
+}
+
+// Splits the non-zero even m = d * 2^s, with dp holding m on the way in and
+// d on the way out, returns s
+static u64 __chonky_limbs_split_2exp(u64* dp, const u64 n) {
+	BigNum d = POS_STATIC_BIG_NUM(dp, n * 8);
+	u64 s = 0;
+	while (dp[s / 64] == 0) s += 64;
+	s += __builtin_ctzll(dp[s / 64]);
+	__chonky_shr(&d, &d, s);
+	return s;
+}
+
+// rp = ap + bp mod mp, for ap and bp below mp (rp can alias either)
+static void __chonky_limbs_add_mod(u64* rp, const u64* ap, const u64* bp, const u64* mp, const u64 n) {
+	const u64 carry = __chonky_limbs_add(rp, ap, n, bp, n);
+	if (carry || __chonky_limbs_cmp(rp, mp, n) >= 0) __chonky_limbs_sub(rp, rp, n, mp, n);
+	return;
+}
+
+// rp = ap - bp mod mp, for ap and bp below mp (rp can alias either)
+static void __chonky_limbs_sub_mod(u64* rp, const u64* ap, const u64* bp, const u64* mp, const u64 n) {
+	if (__chonky_limbs_sub(rp, ap, n, bp, n)) __chonky_limbs_add(rp, rp, n, mp, n);
+	return;
+}
+
+// rp = rp / 2 mod mp, for the odd mp
+static void __chonky_limbs_half_mod(u64* rp, const u64* mp, const u64 n) {
+	const u64 carry = (rp[0] & 1) ? __chonky_limbs_add(rp, rp, n, mp, n) : 0;
+	__chonky_limbs_rshift_1(rp, n);
+	rp[n - 1] |= carry << 63;
+	return;
+}
+
+// rp = x * R mod m for a small x, with |x| < m, small being a scratch of n limbs
+static void __chonky_mont_from_small(const ChonkyMontgomery* ctx, u64* rp, const s64 x, u64* small, u64* temp) {
+	const u64 n = ctx -> size;
+	__chonky_limbs_zero(small, n);
+	small[0] = (x < 0) ? -x : x;
+	__chonky_mont_mul(ctx, rp, small, ctx -> r2 -> data_64, temp);
+	if (x < 0 && __chonky_limbs_real_size(rp, n) > 0) __chonky_limbs_sub(rp, ctx -> mod -> data_64, n, rp, n);
+	return;
+}
+
+// Jacobi symbol (a / m) for the odd m
+static s8 __chonky_jacobi_1(u64 a, u64 m) {
+	s8 sign = 1;
+	a %= m;
+	while (a != 0) {
+		while (!(a & 1)) {
+			a >>= 1;
+			if ((m & 7) == 3 || (m & 7) == 5) sign = -sign;
+		}
+
+		const u64 temp = a;
+		a = m, m = temp;
+		if ((a & 3) == 3 && (m & 3) == 3) sign = -sign;
+		a %= m;
+	}
+	return (m == 1) ? sign : 0;
+}
+
+// Jacobi symbol (d / n) for a small odd d and the odd n, through reciprocity
+static s8 __chonky_jacobi_small(const s64 d, const u64* np, const u64 n) {
+	const u64 a = (d < 0) ? -d : d;
+	s8 sign = 1;
+	if (d < 0 && (np[0] & 3) == 3) sign = -sign;
+	if ((a & 3) == 3 && (np[0] & 3) == 3) sign = -sign;
+	return sign * __chonky_jacobi_1(__chonky_limbs_mod_1(np, n, a), a);
+}
+
+// Whether the n limbs of ap, with a non-zero top limb, are a perfect square,
+// through Newton's iteration from above (-1 on failure)
+static s8 __chonky_limbs_is_square(const u64* ap, const u64 n) {
+	const u64 m = n + 2;
+	u64* temp = __chonky_calloc(5 * m + CHONKY_DIVREM_TEMP_SIZE(n, n), sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate square root buffers.");
+		return -1;
+	}
+
+	u64* x = temp;
+	u64* y = x + m;
+	u64* q = y + m;
+	u64* sq = q + m;
+	u64* div_temp = sq + 2 * m;
+
+	// x = 2^ceil(bits / 2) >= sqrt(a)
+	const u64 half = (n * 64 - __builtin_clzll(ap[n - 1]) + 1) / 2;
+	x[half / 64] = 1ULL << (half % 64);
+
+	u64 xn = 0;
+	while (TRUE) {
+		xn = __chonky_limbs_real_size(x, m);
+		__chonky_limbs_zero(q, m);
+		if (xn <= n) __chonky_limbs_divrem(q, NULL, ap, n, x, xn, div_temp);
+		
+		// y = (x + a / x) / 2, until it stops decreasing
+		__chonky_limbs_add(y, x, m, q, m);
+		__chonky_limbs_rshift_1(y, m);
+		if (__chonky_limbs_cmp(y, x, m) >= 0) break;
+		__chonky_limbs_copy(x, y, m);
+	}
+
+	if (__chonky_limbs_sqr(sq, x, xn) == NULL) {
+		__chonky_free(temp);
+		return -1;
+	}
+
+	const s8 is_square = (__chonky_limbs_real_size(sq, 2 * xn) == n && __chonky_limbs_cmp(sq, ap, n) == 0);
+
+	__chonky_free(temp);
+
+	return is_square;
+}
+
+// Strong Lucas probable prime test with Selfridge's parameters: the first D
+// in 5, -7, 9, -11, ... with (D / n) = -1, P = 1 and Q = (1 - D) / 4.
+// NOTE: n must be odd and bigger than the small primes, returns 1 for probable
+// primes, 0 for composites and -1 on failure
+static s8 __chonky_strong_lucas(const ChonkyMontgomery* ctx) {
+	const u64 n = ctx -> size;
+	const u64* mp = ctx -> mod -> data_64;
+
+	// Perfect squares never reach (D / n) = -1, so they are ruled out once
+	// the first few values of D failed.
+	s64 d_value = 5;
+	for (u64 attempts = 1; ; ++attempts, d_value = (d_value > 0) ? -(d_value + 2) : -d_value + 2) {
+		const s8 jacobi = __chonky_jacobi_small(d_value, mp, n);
+		if (jacobi == -1) break;
+		else if (jacobi == 0) return 0;
+		
+		if (attempts == 8) {
+			const s8 is_square = __chonky_limbs_is_square(mp, n);
+			if (is_square != 0) return (is_square < 0) ? -1 : 0;
+		}
+	}
+
+	const u64 temp_size = __chonky_mont_temp_size(ctx);
+	u64* temp = __chonky_calloc(temp_size + 8 * n + 1, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate lucas buffers.");
+		return -1;
+	}
+
+	u64* u = temp + temp_size;
+	u64* v = u + n;
+	u64* qk = v + n;
+	u64* q = qk + n;
+	u64* dm = q + n;
+	u64* t = dm + n;
+	u64* small = t + n;
+	u64* dp = small + n;
+
+	__chonky_mont_from_small(ctx, dm, d_value, small, temp);
+	__chonky_mont_from_small(ctx, q, (1 - d_value) / 4, small, temp);
+
+	// n + 1 = d * 2^s
+	const u64 one_limb = 1;
+	__chonky_limbs_copy(dp, mp, n);
+	dp[n] = __chonky_limbs_add_in(dp, n, &one_limb, 1);
+	const u64 s = __chonky_limbs_split_2exp(dp, n + 1);
+	const u64 d_size = __chonky_limbs_real_size(dp, n + 1);
+	const u64 d_bits = d_size * 64 - __builtin_clzll(dp[d_size - 1]);
+
+	// U_1 = 1, V_1 = P = 1 and Q^1
+	__chonky_mont_from_small(ctx, u, 1, small, temp);
+	__chonky_limbs_copy(v, u, n);
+	__chonky_limbs_copy(qk, q, n);
+
+	bool is_failed = FALSE;
+	for (s64 i = d_bits - 2; !is_failed && i >= 0; --i) {
+		// U_2k = U_k V_k, V_2k = V_k^2 - 2 Q^k and Q^2k = (Q^k)^2
+		__chonky_mont_mul(ctx, u, u, v, temp);
+		is_failed = (__chonky_mont_sqr(ctx, v, v, temp) == NULL);
+		__chonky_limbs_add_mod(t, qk, qk, mp, n);
+		__chonky_limbs_sub_mod(v, v, t, mp, n);
+		is_failed |= (__chonky_mont_sqr(ctx, qk, qk, temp) == NULL);
+		if (!GET_BIT(dp[i / 64], i % 64)) continue;
+
+		// U_2k+1 = (P U_2k + V_2k) / 2, V_2k+1 = (D U_2k + P V_2k) / 2 and Q^2k+1 = Q^2k Q
+		__chonky_mont_mul(ctx, t, dm, u, temp);
+		__chonky_limbs_add_mod(u, u, v, mp, n);
+		__chonky_limbs_half_mod(u, mp, n);
+		__chonky_limbs_add_mod(v, t, v, mp, n);
+		__chonky_limbs_half_mod(v, mp, n);
+		__chonky_mont_mul(ctx, qk, qk, q, temp);
+	}
+
+	// Either U_d = 0 or V_(d 2^r) = 0 for some r < s
+	s8 is_prime = (__chonky_limbs_real_size(u, n) == 0);
+	for (u64 r = 0; !is_failed && !is_prime && r < s; ++r) {
+		is_prime = (__chonky_limbs_real_size(v, n) == 0);
+		if (is_prime || r + 1 == s) break;
+		
+		is_failed = (__chonky_mont_sqr(ctx, v, v, temp) == NULL);
+		__chonky_limbs_add_mod(t, qk, qk, mp, n);
+		__chonky_limbs_sub_mod(v, v, t, mp, n);
+		is_failed |= (__chonky_mont_sqr(ctx, qk, qk, temp) == NULL);
+	}
+
+	__chonky_free(temp);
+
+	return is_failed ? -1 : is_prime;
+}
+
+// Strong probable prime test to the base, in Montgomery form, where n - 1 = d * 2^s
+static s8 __chonky_miller_rabin_round(const ChonkyPowOps* ops, const u64* base, const BigNum* d, const u64 s, const u64* one, const u64* minus_one, u64* acc, u64* temp) {
+	const u64 n = ops -> size;
+	__chonky_limbs_copy(acc, one, n);
+	if (__chonky_pow_window(ops, acc, base, d) == NULL) return -1;
+	if (__chonky_limbs_cmp(acc, one, n) == 0 || __chonky_limbs_cmp(acc, minus_one, n) == 0) return 1;
+
+	for (u64 r = 1; r < s; ++r) {
+		if (ops -> sqr(ops, acc, acc, temp) == NULL) return -1;
+		if (__chonky_limbs_cmp(acc, minus_one, n) == 0) return 1;
+		if (__chonky_limbs_cmp(acc, one, n) == 0) return 0;
+	}
+
+	return 0;
+}
+
+// Baillie-PSW when is_bpsw is set, followed by rounds of Miller-Rabin over
+// random bases in [2, n - 1), all over the context of n.
+// NOTE: n must be odd and bigger than the small primes, returns 1 for probable
+// primes, 0 for composites and -1 on failure
+static s8 __chonky_prime_test(const ChonkyMontgomery* ctx, const bool is_bpsw, const u64 rounds) {
+	const u64 n = ctx -> size;
+	const ChonkyPowOps ops = __chonky_montgomery_ops(ctx);
+	u64* temp = __chonky_calloc(ops.temp_size + 6 * n, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate primality test buffers.");
+		return -1;
+	}
+
+	u64* dp = temp + ops.temp_size;
+	u64* one = dp + n;
+	u64* minus_one = one + n;
+	u64* base = minus_one + n;
+	u64* acc = base + n;
+	u64* small = acc + n;
+
+	// n - 1 = d * 2^s
+	__chonky_limbs_copy(dp, ctx -> mod -> data_64, n);
+	dp[0] &= ~1ULL;
+	const u64 s = __chonky_limbs_split_2exp(dp, n);
+	const BigNum d = POS_STATIC_BIG_NUM(dp, n * 8);
+
+	__chonky_mont_from_small(ctx, one, 1, small, temp);
+	__chonky_mont_from_small(ctx, minus_one, -1, small, temp);
+
+	s8 is_prime = 1;
+	if (is_bpsw) {
+		__chonky_mont_from_small(ctx, base, 2, small, temp);
+		is_prime = __chonky_miller_rabin_round(&ops, base, &d, s, one, minus_one, acc, temp);
+		if (is_prime == 1) is_prime = __chonky_strong_lucas(ctx);
+	}
+
+	// The random bases are drawn below 2^(bits - 1), so that they are below n
+	const u64 base_bits = chonky_bit_size(ctx -> mod) - 1;
+	const u64 base_limbs = (base_bits + 63) / 64;
+	for (u64 i = 0; is_prime == 1 && i < rounds; ++i) {
+		__chonky_limbs_zero(base, n);
+		do {
+			if (!__chonky_random_bytes(base, base_limbs * 8)) is_prime = -1;
+			if (base_bits % 64) base[base_limbs - 1] &= (1ULL << (base_bits % 64)) - 1;
+		} while (is_prime == 1 && __chonky_limbs_real_size(base, base_limbs) <= 1 && base[0] < 2);
+		if (is_prime != 1) break;
+
+		__chonky_mont_mul(ctx, base, base, ctx -> r2 -> data_64, temp);
+		is_prime = __chonky_miller_rabin_round(&ops, base, &d, s, one, minus_one, acc, temp);
+	}
+
+	__chonky_free(temp);
+
+	return is_prime;
+}
+
+// Trial division by the small primes, followed by __chonky_prime_test over the
+// magnitude of num, the numbers below the square of the biggest small prime
+// are settled by the former.
+static s8 __chonky_is_probable_prime(const BigNum* num, const bool is_bpsw, const u64 rounds) {
+	pthread_once(&__chonky_small_primes_once, __chonky_small_primes_init);
+	const ChonkySmallPrimes* table = &__chonky_small_primes;
+	const u64 n = num -> limbs;
+	const u64* ap = num -> data_64;
+	if (n == 0 || (n == 1 && ap[0] < 2)) return 0;
+	else if (!(ap[0] & 1)) return (n == 1 && ap[0] == 2);
+
+	u32* residues = __chonky_calloc(CHONKY_SIEVE_PRIMES, sizeof(u32));
+	if (residues == NULL) {
+		WARNING_LOG("Failed to allocate the residues.");
+		return -1;
+	}
+
+	__chonky_small_residues(residues, ap, n);
+	for (u32 i = 0; i < CHONKY_SIEVE_PRIMES; ++i) {
+		if (residues[i] != 0) continue;
+		__chonky_free(residues);
+		return (n == 1 && ap[0] == table -> primes[i]);
+	}
+
+	__chonky_free(residues);
+
+	const u64 max_prime = table -> primes[CHONKY_SIEVE_PRIMES - 1];
+	if (n == 1 && ap[0] < max_prime * max_prime) return 1;
+
+	ChonkyMontgomery* ctx = alloc_chonky_montgomery(num);
+	if (ctx == NULL) return -1;
+	
+	const s8 is_prime = __chonky_prime_test(ctx, is_bpsw, rounds);
+	dealloc_chonky_montgomery(ctx);
+
+	return is_prime;
+}
+
+// res = a random prime of exactly bits bits, with the top two set, so that the
+// product of two of them takes exactly twice their bits.
+// NOTE: res must have space for ceil(bits / 64) limbs
+CHONKY_FAILABLE static BigNum* __chonky_gen_prime(BigNum* res, const u64 bits, const u64 rounds) {
+	pthread_once(&__chonky_small_primes_once, __chonky_small_primes_init);
+	const ChonkySmallPrimes* table = &__chonky_small_primes;
+	const u64 n = (bits + 63) / 64;
+	CHONKY_ASSERT(bits >= 2 && res -> size / 8 >= n);
+
+	u32* residues = __chonky_calloc(CHONKY_SIEVE_PRIMES, sizeof(u32));
+	bool* is_composite = __chonky_calloc(CHONKY_SIEVE_SIZE, sizeof(bool));
+	u64* start = __chonky_calloc(2 * n, sizeof(u64));
+	if (residues == NULL || is_composite == NULL || start == NULL) {
+		__chonky_free(residues);
+		__chonky_free(is_composite);
+		__chonky_free(start);
+		WARNING_LOG("Failed to allocate the sieve.");
+		return NULL;
+	}
+
+	u64* candidate = start + n;
+	BigNum candidate_num = POS_STATIC_BIG_NUM(candidate, n * 8);
+	const u64 step = 2 * CHONKY_SIEVE_SIZE;
+
+	s8 is_prime = 0;
+	while (is_prime == 0) {
+		// Random odd start with the top two bits set
+		if (!__chonky_random_bytes(start, n * 8)) {
+			is_prime = -1;
+			break;
+		}
+
+		if (bits % 64) start[n - 1] &= (1ULL << (bits % 64)) - 1;
+		start[(bits - 1) / 64] |= 1ULL << ((bits - 1) % 64);
+		start[(bits - 2) / 64] |= 1ULL << ((bits - 2) % 64);
+		start[0] |= 1;
+
+		// Candidates this small might be small primes themselves, which the
+		// sieve would discard, but they are cheap enough to test one by one.
+		if (bits <= 32) {
+			__chonky_limbs_copy(candidate, start, n);
+			__chonky_trim(&candidate_num, n);
+			is_prime = __chonky_is_probable_prime(&candidate_num, TRUE, rounds);
+			continue;
+		}
+
+		__chonky_small_residues(residues, start, n);
+
+		bool is_exhausted = FALSE;
+		while (is_prime == 0 && !is_exhausted) {
+			// start + 2k = 0 mod p for k = -r / 2 mod p, r being the residue of start
+			for (u64 k = 0; k < CHONKY_SIEVE_SIZE; ++k) is_composite[k] = FALSE;
+			for (u32 i = 0; i < CHONKY_SIEVE_PRIMES; ++i) {
+				const u64 p = table -> primes[i];
+				for (u64 k = ((p - residues[i]) % p) * ((p + 1) / 2) % p; k < CHONKY_SIEVE_SIZE; k += p) is_composite[k] = TRUE;
+			}
+
+			for (u64 k = 0; is_prime == 0 && k < CHONKY_SIEVE_SIZE; ++k) {
+				if (is_composite[k]) continue;
+
+				// The candidates must not outgrow the bit size
+				const u64 offset = 2 * k;
+				__chonky_limbs_copy(candidate, start, n);
+				if (__chonky_limbs_add_in(candidate, n, &offset, 1) || ((bits % 64) && (candidate[n - 1] >> (bits % 64)))) {
+					is_exhausted = TRUE;
+					break;
+				}
+
+				__chonky_trim(&candidate_num, n);
+				ChonkyMontgomery* ctx = alloc_chonky_montgomery(&candidate_num);
+				if (ctx == NULL) {
+					is_prime = -1;
+					break;
+				}
+
+				is_prime = __chonky_prime_test(ctx, TRUE, rounds);
+				dealloc_chonky_montgomery(ctx);
+			}
+
+			if (is_prime != 0 || is_exhausted) break;
+
+			// Move to the next interval, together with the residues of its start
+			is_exhausted = __chonky_limbs_add_in(start, n, &step, 1);
+			for (u32 i = 0; i < CHONKY_SIEVE_PRIMES; ++i) residues[i] = (residues[i] + step) % table -> primes[i];
+		}
+	}
+
+	if (is_prime == 1) {
+		const u64 prev_limbs = res -> limbs;
+		__chonky_limbs_copy(res -> data_64, candidate, n);
+
+		// Clear what is left of the previous value
+		if (prev_limbs > n) __chonky_limbs_zero(res -> data_64 + n, prev_limbs - n);
+		__chonky_trim(res, n);
+	}
+
+	__chonky_free(residues);
+	__chonky_free(is_composite);
+	__chonky_free(start);
+
+	return (is_prime == 1) ? res : NULL;
+}
+
+/// -------------------------------
+///  Fixed Width Arithmetic
+/// -------------------------------
+// NOTE: Types and kernels for the common fixed sizes, generated by
+// CHONKY_FIXED_KERNELS(bits, n, outer_unroll, inner_unroll): ChonkyU<bits>
+// holds n limbs and ChonkyU<bits>Wide the 2n limbs of a product. Every loop
+// has a constant trip count and the product loops are unrolled by the given
+// factors, so that the small sizes become straight-line carry chains, while
+// the wide ones keep the code small enough to stay in the instruction cache.
+// They never allocate, scan for the used limbs, or branch on the data, the
+// Montgomery final subtraction included. CHONKY_FIXED_VIEW wraps any of them
+// in a BigNum to pass it to the generic operations, while
+// chonky_u<bits>_from_num loads a BigNum back.
+#define CHONKY_PRAGMA(x) _Pragma(#x)
+#define CHONKY_UNROLL(n) CHONKY_PRAGMA(GCC unroll n)
+
+#define CHONKY_FIXED_VIEW(x) POS_STATIC_BIG_NUM((x).limbs, sizeof((x).limbs))
+
+#define CHONKY_FIXED_KERNELS(bits, n, outer_unroll, inner_unroll)                                                      \
+	EXPORT_STRUCTURE typedef struct ChonkyU##bits {                                                                   \
+		u64 limbs[n];                                                                                                 \
+	} ChonkyU##bits;                                                                                                  \
+                                                                                                                      \
+	EXPORT_STRUCTURE typedef struct ChonkyU##bits##Wide {                                                             \
+		u64 limbs[2 * (n)];                                                                                           \
+	} ChonkyU##bits##Wide;                                                                                            \
+                                                                                                                      \
+	/* R = 2^(64 * n), r2 = R^2 mod m */                                                                              \
+	EXPORT_STRUCTURE typedef struct ChonkyU##bits##Mont {                                                             \
+		ChonkyU##bits mod;                                                                                            \
+		ChonkyU##bits r2;                                                                                             \
+		u64 m_inv;                                                                                                    \
+	} ChonkyU##bits##Mont;                                                                                            \
+                                                                                                                      \
+	/* Returns FALSE when the magnitude of num does not fit */                                                        \
+	EXPORT_FUNCTION bool chonky_u##bits##_from_num(ChonkyU##bits* res, const BigNum* num) {                           \
+		const u64 size = chonky_real_size_64(num);                                                                    \
+		if (size > (n)) return FALSE;                                                                                 \
+		for (u64 i = 0; i < (n); ++i) (res -> limbs)[i] = (i < size) ? (num -> data_64)[i] : 0;                      \
+		return TRUE;                                                                                                  \
+	}                                                                                                                 \
+                                                                                                                      \
+	/* res = a + b, returns the carry out */                                                                          \
+	EXPORT_FUNCTION u64 chonky_u##bits##_add(ChonkyU##bits* res, const ChonkyU##bits* a, const ChonkyU##bits* b) {    \
+		u8 carry = 0;                                                                                                 \
+		CHONKY_UNROLL(n)                                                                                              \
+		for (u64 i = 0; i < (n); ++i) carry = _addcarry_u64(carry, (a -> limbs)[i], (b -> limbs)[i], (res -> limbs) + i); \
+		return carry;                                                                                                 \
+	}                                                                                                                 \
+                                                                                                                      \
+	/* res = a - b, returns the borrow out */                                                                         \
+	EXPORT_FUNCTION u64 chonky_u##bits##_sub(ChonkyU##bits* res, const ChonkyU##bits* a, const ChonkyU##bits* b) {    \
+		u8 borrow = 0;                                                                                                \
+		CHONKY_UNROLL(n)                                                                                              \
+		for (u64 i = 0; i < (n); ++i) borrow = _subborrow_u64(borrow, (a -> limbs)[i], (b -> limbs)[i], (res -> limbs) + i); \
+		return borrow;                                                                                                \
+	}                                                                                                                 \
+                                                                                                                      \
+	/* res = a * b, res can alias the operands */                                                                    \
+	EXPORT_FUNCTION void chonky_u##bits##_mul(ChonkyU##bits##Wide* res, const ChonkyU##bits* a, const ChonkyU##bits* b) { \
+		u64 rp[2 * (n)] = { 0 };                                                                                      \
+		CHONKY_UNROLL(outer_unroll)                                                                                   \
+		for (u64 i = 0; i < (n); ++i) {                                                                               \
+			u64 carry = 0;                                                                                            \
+			CHONKY_UNROLL(inner_unroll)                                                                               \
+			for (u64 j = 0; j < (n); ++j) {                                                                           \
+				const u128 product = ((u128) (a -> limbs)[j]) * (b -> limbs)[i] + rp[i + j] + carry;                  \
+				rp[i + j] = (u64) product;                                                                            \
+				carry = (u64) (product >> 64);                                                                        \
+			}                                                                                                         \
+			rp[i + (n)] = carry;                                                                                      \
+		}                                                                                                             \
+		CHONKY_UNROLL(n)                                                                                              \
+		for (u64 i = 0; i < 2 * (n); ++i) (res -> limbs)[i] = rp[i];                                                 \
+		return;                                                                                                       \
+	}                                                                                                                 \
+                                                                                                                      \
+	/* res = a^2, the cross products are computed once and doubled */                                                 \
+	EXPORT_FUNCTION void chonky_u##bits##_sqr(ChonkyU##bits##Wide* res, const ChonkyU##bits* a) {                     \
+		u64 rp[2 * (n)] = { 0 };                                                                                      \
+		CHONKY_UNROLL(outer_unroll)                                                                                   \
+		for (u64 i = 0; i + 1 < (n); ++i) {                                                                           \
+			u64 carry = 0;                                                                                            \
+			CHONKY_UNROLL(inner_unroll)                                                                               \
+			for (u64 j = i + 1; j < (n); ++j) {                                                                       \
+				const u128 product = ((u128) (a -> limbs)[j]) * (a -> limbs)[i] + rp[i + j] + carry;                  \
+				rp[i + j] = (u64) product;                                                                            \
+				carry = (u64) (product >> 64);                                                                        \
+			}                                                                                                         \
+			rp[i + (n)] = carry;                                                                                      \
+		}                                                                                                             \
+                                                                                                                      \
+		u8 carry = 0;                                                                                                 \
+		u64 high = 0;                                                                                                 \
+		CHONKY_UNROLL(n)                                                                                              \
+		for (u64 i = 0; i < (n); ++i) {                                                                               \
+			const u128 square = ((u128) (a -> limbs)[i]) * (a -> limbs)[i];                                          \
+			const u64 lo = (rp[2 * i] << 1) | high;                                                                   \
+			high = rp[2 * i + 1] >> 63;                                                                               \
+			const u64 hi = (rp[2 * i + 1] << 1) | (rp[2 * i] >> 63);                                                  \
+			carry = _addcarry_u64(carry, lo, (u64) square, (res -> limbs) + 2 * i);                                  \
+			carry = _addcarry_u64(carry, hi, (u64) (square >> 64), (res -> limbs) + 2 * i + 1);                      \
+		}                                                                                                             \
+		return;                                                                                                       \
+	}                                                                                                                 \
+                                                                                                                      \
+	/* CIOS Montgomery multiplication, res = a * b * R^-1 mod m, for a, b < m, res can alias the operands */         \
+	EXPORT_FUNCTION void chonky_u##bits##_mont_mul(ChonkyU##bits* res, const ChonkyU##bits* a, const ChonkyU##bits* b, const ChonkyU##bits##Mont* ctx) { \
+		const u64* mp = ctx -> mod.limbs;                                                                             \
+		u64 tp[(n) + 2] = { 0 };                                                                                      \
+		CHONKY_UNROLL(outer_unroll)                                                                                   \
+		for (u64 i = 0; i < (n); ++i) {                                                                               \
+			u64 carry = 0;                                                                                            \
+			CHONKY_UNROLL(inner_unroll)                                                                               \
+			for (u64 j = 0; j < (n); ++j) {                                                                           \
+				const u128 product = ((u128) (a -> limbs)[j]) * (b -> limbs)[i] + tp[j] + carry;                      \
+				tp[j] = (u64) product;                                                                                \
+				carry = (u64) (product >> 64);                                                                        \
+			}                                                                                                         \
+			const u128 top = ((u128) tp[n]) + carry;                                                                  \
+			tp[n] = (u64) top;                                                                                        \
+			tp[(n) + 1] = (u64) (top >> 64);                                                                          \
+                                                                                                                      \
+			/* Reduce the lowest limb and drop it, moving the window down */                                          \
+			const u64 q = tp[0] * ctx -> m_inv;                                                                       \
+			carry = (u64) ((((u128) q) * mp[0] + tp[0]) >> 64);                                                       \
+			CHONKY_UNROLL(inner_unroll)                                                                               \
+			for (u64 j = 1; j < (n); ++j) {                                                                           \
+				const u128 product = ((u128) q) * mp[j] + tp[j] + carry;                                              \
+				tp[j - 1] = (u64) product;                                                                            \
+				carry = (u64) (product >> 64);                                                                        \
+			}                                                                                                         \
+			const u128 last = ((u128) tp[n]) + carry;                                                                 \
+			tp[(n) - 1] = (u64) last;                                                                                 \
+			tp[n] = tp[(n) + 1] + (u64) (last >> 64);                                                                 \
+		}                                                                                                             \
+                                                                                                                      \
+		/* tp < 2m, m is subtracted unless it borrows, selecting by mask */                                           \
+		u64 diff[n];                                                                                                  \
+		u8 borrow = 0;                                                                                                \
+		CHONKY_UNROLL(n)                                                                                              \
+		for (u64 i = 0; i < (n); ++i) borrow = _subborrow_u64(borrow, tp[i], mp[i], diff + i);                       \
+		const u64 keep = -(u64) (borrow & (tp[n] == 0));                                                              \
+		CHONKY_UNROLL(n)                                                                                              \
+		for (u64 i = 0; i < (n); ++i) (res -> limbs)[i] = (tp[i] & keep) | (diff[i] & ~keep);                        \
+		return;                                                                                                       \
+	}                                                                                                                 \
+                                                                                                                      \
+	/* Returns FALSE when the modulus is even */                                                                      \
+	EXPORT_FUNCTION bool chonky_u##bits##_mont_init(ChonkyU##bits##Mont* ctx, const ChonkyU##bits* mod) {             \
+		if (!((mod -> limbs)[0] & 1)) {                                                                               \
+			WARNING_LOG("Montgomery arithmetic requires an odd modulus.");                                            \
+			return FALSE;                                                                                             \
+		}                                                                                                             \
+                                                                                                                      \
+		const u64 dn = __chonky_limbs_real_size(mod -> limbs, n);                                                     \
+		u64 r2_full[2 * (n) + 1] = { 0 };                                                                             \
+		u64 temp[CHONKY_DIVREM_TEMP_SIZE(2 * (n) + 1, n)] = { 0 };                                                    \
+		r2_full[2 * (n)] = 1;                                                                                         \
+                                                                                                                      \
+		ctx -> mod = *mod;                                                                                            \
+		ctx -> r2 = (ChonkyU##bits) { 0 };                                                                            \
+		ctx -> m_inv = __chonky_mont_inverse((mod -> limbs)[0]);                                                      \
+		__chonky_limbs_divrem(NULL, ctx -> r2.limbs, r2_full, 2 * (n) + 1, mod -> limbs, dn, temp);                  \
+		return TRUE;                                                                                                  \
+	}                                                                                                                 \
+                                                                                                                      \
+	/* res = a * R mod m, for a < m */                                                                                \
+	EXPORT_FUNCTION void chonky_u##bits##_to_mont(ChonkyU##bits* res, const ChonkyU##bits* a, const ChonkyU##bits##Mont* ctx) { \
+		chonky_u##bits##_mont_mul(res, a, &(ctx -> r2), ctx);                                                         \
+		return;                                                                                                       \
+	}                                                                                                                 \
+                                                                                                                      \
+	/* res = a * R^-1 mod m */                                                                                        \
+	EXPORT_FUNCTION void chonky_u##bits##_from_mont(ChonkyU##bits* res, const ChonkyU##bits* a, const ChonkyU##bits##Mont* ctx) { \
+		const ChonkyU##bits one = { .limbs = { 1 } };                                                                 \
+		chonky_u##bits##_mont_mul(res, a, &one, ctx);                                                                 \
+		return;                                                                                                       \
+	}
+
+CHONKY_FIXED_KERNELS(256, 4, 4, 4)
+CHONKY_FIXED_KERNELS(384, 6, 6, 6)
+CHONKY_FIXED_KERNELS(512, 8, 8, 8)
+CHONKY_FIXED_KERNELS(2048, 32, 1, 8)
+CHONKY_FIXED_KERNELS(4096, 64, 1, 8)
+
+/// -------------------------------
+///  Batch Operations
+/// -------------------------------
+// NOTE: The batch operations process CHONKY_BATCH_LANES independent numbers at
+// once, one per SIMD lane. The operands are stored structure-of-arrays, digit
+// d of lane l at [d * lanes + l], in radix 2^28, so that the products fit a
+// 32x32 bits multiplication and many of them can be accumulated in the 64 bits
+// of a lane before propagating the carries (carry-save).
+// Only the row kernels depend on the instruction set, everything else is
+// shared and works over plain arrays of digits.
+#define CHONKY_BATCH_DIGIT_BITS   28ULL
+#define CHONKY_BATCH_DIGIT_MASK   ((1ULL << CHONKY_BATCH_DIGIT_BITS) - 1)
+#define CHONKY_BATCH_DIGITS(n)    (((n) * 64 + CHONKY_BATCH_DIGIT_BITS - 1) / CHONKY_BATCH_DIGIT_BITS)
+#define CHONKY_BATCH_MAX_LANES_   8
+
+// Caps the lanes used by the batch operations, 0 disables the SIMD kernels,
+// so that every element goes through the plain operations
+#ifndef CHONKY_BATCH_MAX_LANES
+	#define CHONKY_BATCH_MAX_LANES CHONKY_BATCH_MAX_LANES_
+#endif //CHONKY_BATCH_MAX_LANES
+
+typedef struct ChonkyBatchOps {
+	// rp[j] += ap[j] * bp, for j < d, where bp is a single digit per lane
+	void (*addmul)(u64* rp, const u64* ap, const u64* bp, const u64 d);
+	// rp[j] = ap[j] + bp[j], with bp[j] negated in the lanes where neg is set
+	void (*add)(u64* rp, const u64* ap, const u64* bp, const u64* neg, const u64 d);
+	// Propagates the (signed) carries of d digits, the last one keeps its own
+	void (*carry)(u64* rp, const u64 d);
+	u64 lanes;
+} ChonkyBatchOps;
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+#define CHONKY_BATCH_KERNELS(isa, target_isa, lanes, vec_type, mul_epu32)                                             \
+	typedef u64 ChonkyLanes_##isa __attribute__((vector_size((lanes) * 8), aligned(8)));                              \
+	typedef s64 ChonkySignedLanes_##isa __attribute__((vector_size((lanes) * 8), aligned(8)));                        \
+                                                                                                                      \
+	__attribute__((target(target_isa))) static void __chonky_batch_addmul_##isa(u64* rp, const u64* ap, const u64* bp, const u64 d) { \
+		const vec_type b = (vec_type) *(const ChonkyLanes_##isa*) bp;                                                 \
+		ChonkyLanes_##isa* r = (ChonkyLanes_##isa*) rp;                                                               \
+		const ChonkyLanes_##isa* a = (const ChonkyLanes_##isa*) ap;                                                   \
+		for (u64 j = 0; j < d; ++j) r[j] += (ChonkyLanes_##isa) mul_epu32((vec_type) a[j], b);                      \
+		return;                                                                                                       \
+	}                                                                                                                 \
+                                                                                                                      \
+	__attribute__((target(target_isa))) static void __chonky_batch_add_##isa(u64* rp, const u64* ap, const u64* bp, const u64* neg, const u64 d) { \
+		const ChonkyLanes_##isa mask = *(const ChonkyLanes_##isa*) neg;                                               \
+		ChonkyLanes_##isa* r = (ChonkyLanes_##isa*) rp;                                                               \
+		const ChonkyLanes_##isa* a = (const ChonkyLanes_##isa*) ap;                                                   \
+		const ChonkyLanes_##isa* b = (const ChonkyLanes_##isa*) bp;                                                   \
+		for (u64 j = 0; j < d; ++j) r[j] = a[j] + ((b[j] ^ mask) - mask);                                             \
+		return;                                                                                                       \
+	}                                                                                                                 \
+                                                                                                                      \
+	__attribute__((target(target_isa))) static void __chonky_batch_carry_##isa(u64* rp, const u64 d) {              \
+		ChonkyLanes_##isa* r = (ChonkyLanes_##isa*) rp;                                                               \
+		for (u64 j = 0; j + 1 < d; ++j) {                                                                             \
+			r[j + 1] += (ChonkyLanes_##isa) ((ChonkySignedLanes_##isa) r[j] >> CHONKY_BATCH_DIGIT_BITS);             \
+			r[j] &= CHONKY_BATCH_DIGIT_MASK;                                                                          \
+		}                                                                                                             \
+		return;                                                                                                       \
+	}
+
+CHONKY_BATCH_KERNELS(avx2, "avx2", 4, __m256i, _mm256_mul_epu32)
+CHONKY_BATCH_KERNELS(avx512, "avx512f", 8, __m512i, _mm512_mul_epu32)
+
+static ChonkyBatchOps __chonky_batch_ops(void) {
+	__builtin_cpu_init();
+	if (CHONKY_BATCH_MAX_LANES >= 8 && __builtin_cpu_supports("avx512f")) {
+		return (ChonkyBatchOps) { .addmul = __chonky_batch_addmul_avx512, .add = __chonky_batch_add_avx512, .carry = __chonky_batch_carry_avx512, .lanes = 8 };
+	} else if (CHONKY_BATCH_MAX_LANES >= 4 && __builtin_cpu_supports("avx2")) {
+		return (ChonkyBatchOps) { .addmul = __chonky_batch_addmul_avx2, .add = __chonky_batch_add_avx2, .carry = __chonky_batch_carry_avx2, .lanes = 4 };
+	}
+	
+	return (ChonkyBatchOps) { 0 };
+}
+
+#else
+
+static ChonkyBatchOps __chonky_batch_ops(void) {
+	return (ChonkyBatchOps) { 0 };
+}
+
+#endif //defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+// Loads the n limbs of ap as the d digits of the given lane
+static void __chonky_batch_load(u64* rp, const u64 lanes, const u64 lane, const u64* ap, const u64 n, const u64 d) {
+	for (u64 i = 0; i < d; ++i) {
+		const u64 bit = i * CHONKY_BATCH_DIGIT_BITS;
+		const u64 limb = bit / 64;
+		const u64 offset = bit % 64;
+		
+		u64 digit = 0;
+		if (limb < n) digit = ap[limb] >> offset;
+		if (offset > 64 - CHONKY_BATCH_DIGIT_BITS && limb + 1 < n) digit |= ap[limb + 1] << (64 - offset);
+		
+		rp[i * lanes + lane] = digit & CHONKY_BATCH_DIGIT_MASK;
+	}
+	
+	return;
+}
+
+// Stores the d digits of the given lane as n limbs, propagating the carries,
+// the value is expected to be non-negative and to fit.
+static void __chonky_batch_store(u64* rp, const u64 n, const u64* ap, const u64 lanes, const u64 lane, const u64 d) {
+	__chonky_limbs_zero(rp, n);
+	
+	s64 carry = 0;
+	for (u64 i = 0; i < d; ++i) {
+		const s64 value = (s64) ap[i * lanes + lane] + carry;
+		const u64 digit = value & CHONKY_BATCH_DIGIT_MASK;
+		carry = value >> CHONKY_BATCH_DIGIT_BITS;
+		
+		const u64 bit = i * CHONKY_BATCH_DIGIT_BITS;
+		const u64 limb = bit / 64;
+		const u64 offset = bit % 64;
+		if (limb < n) rp[limb] |= digit << offset;
+		if (offset > 64 - CHONKY_BATCH_DIGIT_BITS && limb + 1 < n) rp[limb + 1] |= digit >> (64 - offset);
+	}
+	
+	CHONKY_ASSERT(carry == 0);
+	
+	return;
+}
+
+// rp = ap * bp, over d digits each, rp takes 2 * d digits
+static void __chonky_batch_mul_digits(const ChonkyBatchOps* ops, u64* rp, const u64* ap, const u64* bp, const u64 d) {
+	const u64 lanes = ops -> lanes;
+	__chonky_limbs_zero(rp, 2 * d * lanes);
+	
+	for (u64 i = 0; i < d; ++i) {
+		ops -> addmul(rp + i * lanes, ap, bp + i * lanes, d);
+		
+		// Every digit takes at most one product per row, each below 2^56
+		if ((i & 63) == 63) ops -> carry(rp, 2 * d);
+	}
+	
+	return;
+}
+
+// Montgomery context of a batch, every lane has its own odd modulus, all of
+// them below R = 2^(28 * d).
+typedef struct ChonkyBatchMont {
+	const ChonkyBatchOps* ops;
+	u64* mod;
+	u64* m_inv;
+	u64 size;
+} ChonkyBatchMont;
+
+#define CHONKY_BATCH_MONT_TEMP_SIZE(d, lanes) ((2 * (d) + 2) * (lanes) + (lanes))
+
+// rp = ap * bp / R mod m, for ap, bp < m, rp can alias the operands
+static void __chonky_batch_mont_mul(const ChonkyBatchMont* ctx, u64* rp, const u64* ap, const u64* bp, u64* temp) {
+	const ChonkyBatchOps* ops = ctx -> ops;
+	const u64 lanes = ops -> lanes;
+	const u64 d = ctx -> size;
+	u64* tp = temp;
+	u64* mp = temp + (2 * d + 2) * lanes;
+	__chonky_limbs_zero(tp, (2 * d + 2) * lanes);
+
+	for (u64 i = 0; i < d; ++i) {
+		u64* row = tp + i * lanes;
+		ops -> addmul(row, bp, ap + i * lanes, d);
+		for (u64 l = 0; l < lanes; ++l) mp[l] = ((row[l] & CHONKY_BATCH_DIGIT_MASK) * (ctx -> m_inv)[l]) & CHONKY_BATCH_DIGIT_MASK;
+		ops -> addmul(row, ctx -> mod, mp, d);
+		
+		// The low digit is now a multiple of 2^28, only its carry is left
+		for (u64 l = 0; l < lanes; ++l) row[lanes + l] += row[l] >> CHONKY_BATCH_DIGIT_BITS;
+		
+		// Every digit takes at most two products per row, each below 2^56
+		if ((i & 31) == 31) ops -> carry(row + lanes, 2 * d + 1 - i);
+	}
+
+	// t < 2m, so that a single subtraction is left
+	u64* res = tp + d * lanes;
+	ops -> carry(res, d + 1);
+	
+	for (u64 l = 0; l < lanes; ++l) {
+		s64 borrow = 0;
+		for (u64 i = 0; i <= d; ++i) {
+			const s64 value = (s64) res[i * lanes + l] - (s64) ((i < d) ? (ctx -> mod)[i * lanes + l] : 0) + borrow;
+			borrow = value >> CHONKY_BATCH_DIGIT_BITS;
+		}
+		
+		if (borrow < 0) continue;
+		
+		borrow = 0;
+		for (u64 i = 0; i <= d; ++i) {
+			const s64 value = (s64) res[i * lanes + l] - (s64) ((i < d) ? (ctx -> mod)[i * lanes + l] : 0) + borrow;
+			res[i * lanes + l] = value & CHONKY_BATCH_DIGIT_MASK;
+			borrow = value >> CHONKY_BATCH_DIGIT_BITS;
+		}
+	}
+	
+	__chonky_limbs_copy(rp, res, d * lanes);
+	
+	return;
+}
+
+#define CHONKY_BATCH_WINDOW 4
+
+static u64 __chonky_batch_exp_window(const BigNum* exp, const u64 pos) {
+	const u64 exp_bits = chonky_bit_size(exp);
+	u64 window = 0;
+	for (u64 i = pos + CHONKY_BATCH_WINDOW; i > pos; --i) {
+		window = (window << 1) | ((i - 1 < exp_bits) ? EXP_BIT(exp, i - 1) : 0);
+	}
+	return window;
+}
+
+// Fixed window exponentiation over a group of lanes with odd moduli, the
+// lanes past count are padded with x^0 mod 1.
+CHONKY_FAILABLE static BigNum** __chonky_batch_pow_mod(const ChonkyBatchOps* ops, BigNum** res, BigNum** num, BigNum** exp, BigNum** mod, const u64 count) {
+	const u64 lanes = ops -> lanes;
+	
+	u64 n = 1;
+	u64 num_size = 0;
+	u64 exp_bits = 0;
+	for (u64 l = 0; l < count; ++l) {
+		n = MAX(n, chonky_real_size_64(mod[l]));
+		num_size = MAX(num_size, chonky_real_size_64(num[l]));
+		exp_bits = MAX(exp_bits, chonky_bit_size(exp[l]));
+	}
+
+	const u64 d = CHONKY_BATCH_DIGITS(n);
+	const u64 entries = 1ULL << CHONKY_BATCH_WINDOW;
+	const u64 elem = d * lanes;
+	
+	// R^2 = 2^(56 * d) and the bases are reduced through long divisions
+	const u64 r2_size = (2 * d * CHONKY_BATCH_DIGIT_BITS) / 64 + 1;
+	const u64 div_max = MAX(r2_size, num_size);
+	const u64 div_size = div_max + n + CHONKY_DIVREM_TEMP_SIZE(div_max, n);
+	
+	u64* temp = __chonky_calloc(CHONKY_BATCH_MONT_TEMP_SIZE(d, lanes) + lanes + (entries + 5) * elem + div_size, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate batch buffers.");
+		return NULL;
+	}
+
+	u64* mont_temp = temp;
+	u64* m_inv = mont_temp + CHONKY_BATCH_MONT_TEMP_SIZE(d, lanes);
+	u64* mod_d = m_inv + lanes;
+	u64* r2 = mod_d + elem;
+	u64* one = r2 + elem;
+	u64* acc = one + elem;
+	u64* selected = acc + elem;
+	u64* table = selected + elem;
+	u64* div_temp = table + entries * elem;
+	u64* div_num = div_temp + CHONKY_DIVREM_TEMP_SIZE(div_max, n);
+	u64* div_rem = div_num + div_max;
+
+	for (u64 l = 0; l < lanes; ++l) {
+		one[l] = 1;
+		if (l >= count) {
+			mod_d[l] = 1;
+			m_inv[l] = CHONKY_BATCH_DIGIT_MASK;
+			continue;
+		}
+		
+		const u64 mn = chonky_real_size_64(mod[l]);
+		const u64* mp = mod[l] -> data_64;
+		__chonky_batch_load(mod_d, lanes, l, mp, mn, d);
+		m_inv[l] = __chonky_mont_inverse(mp[0]) & CHONKY_BATCH_DIGIT_MASK;
+
+		// R^2 mod m
+		__chonky_limbs_zero(div_num, r2_size);
+		div_num[r2_size - 1] = 1ULL << ((2 * d * CHONKY_BATCH_DIGIT_BITS) % 64);
+		__chonky_limbs_divrem(NULL, div_rem, div_num, r2_size, mp, mn, div_temp);
+		__chonky_batch_load(r2, lanes, l, div_rem, mn, d);
+
+		// The base, reduced when not smaller than the modulus
+		const u64 bn = chonky_real_size_64(num[l]);
+		const u64* bp = num[l] -> data_64;
+		if (bn >= mn) {
+			__chonky_limbs_divrem(NULL, div_rem, bp, bn, mp, mn, div_temp);
+			bp = div_rem;
+		}
+		__chonky_batch_load(selected, lanes, l, bp, MIN(bn, mn), d);
+	}
+
+	const ChonkyBatchMont ctx = { .ops = ops, .mod = mod_d, .m_inv = m_inv, .size = d };
+
+	// table[i] = base^i, in Montgomery form
+	__chonky_batch_mont_mul(&ctx, table, one, r2, mont_temp);
+	__chonky_batch_mont_mul(&ctx, table + elem, selected, r2, mont_temp);
+	for (u64 i = 2; i < entries; ++i) __chonky_batch_mont_mul(&ctx, table + i * elem, table + (i - 1) * elem, table + elem, mont_temp);
+
+	__chonky_limbs_copy(acc, table, elem);
+	const u64 windows = (exp_bits + CHONKY_BATCH_WINDOW - 1) / CHONKY_BATCH_WINDOW;
+	for (s64 w = windows - 1; w >= 0; --w) {
+		if ((u64) w != windows - 1) {
+			for (u64 i = 0; i < CHONKY_BATCH_WINDOW; ++i) __chonky_batch_mont_mul(&ctx, acc, acc, acc, mont_temp);
+		}
+
+		for (u64 l = 0; l < lanes; ++l) {
+			const u64 index = (l < count) ? __chonky_batch_exp_window(exp[l], w * CHONKY_BATCH_WINDOW) : 0;
+			for (u64 i = 0; i < d; ++i) selected[i * lanes + l] = table[index * elem + i * lanes + l];
+		}
+
+		__chonky_batch_mont_mul(&ctx, acc, acc, selected, mont_temp);
+	}
+
+	// Leave the Montgomery form by multiplying by 1
+	__chonky_batch_mont_mul(&ctx, acc, acc, one, mont_temp);
+
+	for (u64 l = 0; l < count; ++l) {
+		const u64 mn = chonky_real_size_64(mod[l]);
+		if (chonky_reserve(res[l], mn * 8) == NULL) {
+			__chonky_free(temp);
+			return NULL;
+		}
+		
+		__chonky_batch_store(res[l] -> data_64, res[l] -> size / 8, acc, lanes, l, d);
+		__chonky_trim(res[l], mn);
+		res[l] -> sign = 0;
+	}
+
+	__chonky_free(temp);
+
+	return res;
+}
+
+static bool __chonky_batch_is_valid(BigNum** nums, const u64 count) {
+	if (nums == NULL) return FALSE;
+	for (u64 i = 0; i < count; ++i) {
+		if (!IS_VALID_BIG_NUM(nums[i])) return FALSE;
+	}
+	return TRUE;
+}
+
+// Sums a group of lanes, with different signs the magnitudes are ordered, so
+// that the difference never goes below zero.
+CHONKY_FAILABLE static BigNum** __chonky_batch_add(const ChonkyBatchOps* ops, BigNum** res, BigNum** a, BigNum** b, const u64 count) {
+	const u64 lanes = ops -> lanes;
+	
+	u64 n = 1;
+	for (u64 l = 0; l < count; ++l) n = MAX(n, MAX(chonky_real_size_64(a[l]), chonky_real_size_64(b[l])) + 1);
+	
+	const u64 d = CHONKY_BATCH_DIGITS(n);
+	u64* temp = __chonky_calloc(3 * d * lanes + lanes, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate batch buffers.");
+		return NULL;
+	}
+
+	u64* xp = temp;
+	u64* yp = xp + d * lanes;
+	u64* rp = yp + d * lanes;
+	u64* neg = rp + d * lanes;
+	
+	u8 signs[CHONKY_BATCH_MAX_LANES_] = {0};
+	for (u64 l = 0; l < count; ++l) {
+		const bool is_sub = (a[l] -> sign != b[l] -> sign);
+		const bool is_swapped = is_sub && chonky_is_gt(b[l], a[l]);
+		const BigNum* x = is_swapped ? b[l] : a[l];
+		const BigNum* y = is_swapped ? a[l] : b[l];
+		
+		signs[l] = x -> sign;
+		neg[l] = -((u64) is_sub);
+		__chonky_batch_load(xp, lanes, l, x -> data_64, chonky_real_size_64(x), d);
+		__chonky_batch_load(yp, lanes, l, y -> data_64, chonky_real_size_64(y), d);
+	}
+
+	ops -> add(rp, xp, yp, neg, d);
+	
+	for (u64 l = 0; l < count; ++l) {
+		if (chonky_reserve(res[l], n * 8) == NULL) {
+			__chonky_free(temp);
+			return NULL;
+		}
+		
+		__chonky_batch_store(res[l] -> data_64, res[l] -> size / 8, rp, lanes, l, d);
+		__chonky_trim(res[l], n);
+		res[l] -> sign = is_chonky_zero(res[l]) ? 0 : signs[l];
+	}
+	
+	__chonky_free(temp);
+
+	return res;
+}
+
+CHONKY_FAILABLE static BigNum** __chonky_batch_mul(const ChonkyBatchOps* ops, BigNum** res, BigNum** a, BigNum** b, const u64 count) {
+	const u64 lanes = ops -> lanes;
+	
+	u64 n = 1;
+	for (u64 l = 0; l < count; ++l) n = MAX(n, MAX(chonky_real_size_64(a[l]), chonky_real_size_64(b[l])));
+	
+	const u64 d = CHONKY_BATCH_DIGITS(n);
+	u64* temp = __chonky_calloc(4 * d * lanes, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate batch buffers.");
+		return NULL;
+	}
+
+	u64* xp = temp;
+	u64* yp = xp + d * lanes;
+	u64* rp = yp + d * lanes;
+	
+	u8 signs[CHONKY_BATCH_MAX_LANES_] = {0};
+	u64 sizes[CHONKY_BATCH_MAX_LANES_] = {0};
+	for (u64 l = 0; l < count; ++l) {
+		signs[l] = a[l] -> sign ^ b[l] -> sign;
+		sizes[l] = chonky_real_size_64(a[l]) + chonky_real_size_64(b[l]);
+		__chonky_batch_load(xp, lanes, l, a[l] -> data_64, chonky_real_size_64(a[l]), d);
+		__chonky_batch_load(yp, lanes, l, b[l] -> data_64, chonky_real_size_64(b[l]), d);
+	}
+
+	__chonky_batch_mul_digits(ops, rp, xp, yp, d);
+	
+	for (u64 l = 0; l < count; ++l) {
+		if (chonky_reserve(res[l], MAX(sizes[l], 1) * 8) == NULL) {
+			__chonky_free(temp);
+			return NULL;
+		}
+		
+		__chonky_batch_store(res[l] -> data_64, res[l] -> size / 8, rp, lanes, l, 2 * d);
+		__chonky_trim(res[l], sizes[l]);
+		res[l] -> sign = is_chonky_zero(res[l]) ? 0 : signs[l];
+	}
+	
+	__chonky_free(temp);
+
+	return res;
+}
+
+/// -----------------------------------------
+///  BigNum Public Functions
+/// -----------------------------------------
+// NOTE: Every operation has an `_into` variant writing in a caller owned
+// result, which only grows when it is too small (and is never shrunk), so that
+// reusing the same result does not allocate. The result can be one of the
+// operands, as long as it is the same BigNum.
+EXPORT_FUNCTION BigNum* chonky_add_into(BigNum* res, const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 size = MAX(chonky_real_size_64(a), chonky_real_size_64(b)) + 1;
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+	
+	if ((a -> sign && !b -> sign) || (!a -> sign && b -> sign)) {
+		const BigNum* minuend = a -> sign ? b : a;
+		const BigNum* subtraend = a -> sign ? a : b;
+		__chonky_sub(res, minuend, subtraend);
+	} else {
+		const u8 sign = a -> sign && b -> sign;
+		__chonky_add(res, a, b);
+		res -> sign = sign;
+	}
+	
+	__chonky_limbs_zero(res -> data_64 + size, res -> size / 8 - size);
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_add(const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(MAX(a -> size, b -> size) + 1), 0);
+	if (res == NULL) return NULL;
+	
+	if (chonky_add_into(res, a, b) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_sub_into(BigNum* res, const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	// NOTE: Grow first, as the negated operand is only a view over its data
+	const u64 size = MAX(chonky_real_size_64(a), chonky_real_size_64(b)) + 1;
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	const BigNum neg_b = STATIC_BIG_NUM(b -> data, b -> size, !(b -> sign));
+	
+	return chonky_add_into(res, a, &neg_b);
+}
+
+EXPORT_FUNCTION BigNum* chonky_sub(const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(MAX(a -> size, b -> size) + 1), 0);
+	if (res == NULL) return NULL;
+	
+	if (chonky_sub_into(res, a, b) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mul_into(BigNum* res, const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u8 sign = a -> sign ^ b -> sign;
+	const u64 size = chonky_real_size_64(a) + chonky_real_size_64(b) + 1;
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	if (__chonky_mul_s(res, a, b) == NULL) return NULL;
+	
+	res -> sign = is_chonky_zero(res) ? 0 : sign;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mul(const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(a -> size + b -> size) + 8, 0);
+	if (res == NULL) return NULL;
+	
+	if (chonky_mul_into(res, a, b) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_sqr_into(BigNum* res, const BigNum* num) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 size = 2 * chonky_real_size_64(num) + 1;
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+	
+	if (__chonky_sqr_s(res, num) == NULL) return NULL;
+	
+	res -> sign = 0;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_sqr(const BigNum* num) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(2 * num -> size) + 8, 0);
+	if (res == NULL) return NULL;
+	
+	if (chonky_sqr_into(res, num) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+// Truncated division, the quotient takes the sign a * b and the remainder
+// the sign of the dividend, either of them can be NULL (but not both).
+EXPORT_FUNCTION BigNum* chonky_divmod_into(BigNum* quotient, BigNum* remainder, const BigNum* a, const BigNum* b) {
+	if ((quotient == NULL && remainder == NULL) || (quotient != NULL && !IS_VALID_BIG_NUM(quotient)) || (remainder != NULL && !IS_VALID_BIG_NUM(remainder)) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (quotient == remainder) {
+		WARNING_LOG("The quotient and the remainder must be different numbers.");
+		return NULL;
+	} else if (is_chonky_zero((BigNum*) b)) {
+		WARNING_LOG("Division by zero.");
+		return NULL;
+	}
+
+	const u8 a_sign = a -> sign;
+	const u8 b_sign = b -> sign;
+	const u64 a_size = chonky_real_size_64(a);
+	const u64 b_size = chonky_real_size_64(b);
+	if (quotient != NULL && chonky_reserve(quotient, MAX(a_size, 1) * 8) == NULL) return NULL;
+	if (remainder != NULL && chonky_reserve(remainder, MAX(MIN(a_size, b_size), 1) * 8) == NULL) return NULL;
+
+	if (__chonky_divmod(quotient, remainder, a, b) == NULL) return NULL;
+	
+	if (quotient != NULL) quotient -> sign = is_chonky_zero(quotient) ? 0 : a_sign ^ b_sign;
+	if (remainder != NULL) remainder -> sign = is_chonky_zero(remainder) ? 0 : a_sign;
+
+	return (quotient != NULL) ? quotient : remainder;
+}
+
+EXPORT_FUNCTION BigNum* chonky_div_into(BigNum* res, const BigNum* a, const BigNum* b) {
+	return chonky_divmod_into(res, NULL, a, b);
+}
+
+EXPORT_FUNCTION BigNum* chonky_div(const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(MAX(a -> size, b -> size)), 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_div_into(res, a, b) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+	
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+// Truncated division, returns the quotient and stores the remainder (with the
+// sign of the dividend) in `remainder`, if not NULL, in a single pass.
+EXPORT_FUNCTION BigNum* chonky_divmod(const BigNum* a, const BigNum* b, BigNum** remainder) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* quot = alloc_chonky_num(NULL, align_64(MAX(a -> size, b -> size)), 0);
+	if (quot == NULL) return NULL;
+
+	BigNum* rem = NULL;
+	if (remainder != NULL) {
+		rem = alloc_chonky_num(NULL, align_64(MAX(a -> size, b -> size)), 0);
+		if (rem == NULL) {
+			dealloc_chonky_num(quot);
+			return NULL;
+		}
+	}
+
+	if (chonky_divmod_into(quot, rem, a, b) == NULL) {
+		dealloc_chonky_num(quot);
+		if (rem != NULL) dealloc_chonky_num(rem);
+		return NULL;
+	}
+	
+	if (chonky_resize(quot, 0)) {
+		if (rem != NULL) dealloc_chonky_num(rem);
+		return NULL;
+	}
+	
+	if (remainder != NULL) {
+		if (chonky_resize(rem, 0)) {
+			dealloc_chonky_num(quot);
+			return NULL;
+		}
+		*remainder = rem;
+	}
+
+	return quot;
+}
+
+EXPORT_FUNCTION BigNum* chonky_pow_into(BigNum* res, const BigNum* num, const BigNum* exp) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(exp)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (chonky_real_size(exp) > 4) {
+		WARNING_LOG("Pure exponentiation, does not allow for exponent with more than four bytes (%llu).", chonky_real_size(exp));
+		return NULL;
+	}
+
+	// NOTE: The exponent fits a single limb, so it is kept aside in case the
+	// result overwrites it
+	u64 exp_limb = (exp -> data_64)[0];
+	const BigNum exp_c = POS_STATIC_BIG_NUM(&exp_limb, sizeof(u64));
+	
+	const u8 sign = num -> sign * ((exp -> data)[0] & 0x01);
+	const u64 size = align_64(chonky_real_size(num) * __chonky_spow(2, chonky_real_size(exp) * 8));
+	if (chonky_reserve(res, size) == NULL) return NULL;
+	
+	__chonky_limbs_zero(res -> data_64 + size / 8, (res -> size - size) / 8);
+
+	BigNum res_view = POS_STATIC_BIG_NUM(res -> data, size);
+	if (__chonky_pow(&res_view, num, &exp_c) == NULL) return NULL;
+	res -> limbs = res_view.limbs;
+
+	res -> sign = sign;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_pow(const BigNum* num, const BigNum* exp) {
+	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(exp)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, 8, 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_pow_into(res, num, exp) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+	
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mod_into(BigNum* res, const BigNum* num, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (is_chonky_zero((BigNum*) mod)) {
+		WARNING_LOG("Division by zero.");
+		return NULL;
+	}
+
+	const u64 size = MAX(MIN(chonky_real_size_64(num), chonky_real_size_64(mod)), 1);
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	if (__chonky_mod(res, num, mod) == NULL) return NULL;
+	
+	res -> sign = 0;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mod(const BigNum* num, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(chonky_real_size(mod)), 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_mod_into(res, num, mod) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+	
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mersenne_reduce_into(BigNum* res, const BigNum* num, const ChonkyMersenne* ctx) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 n = ctx -> size;
+	const u64 num_size = MAX(chonky_real_size_64(num), 1);
+	const u64 temp_size = __chonky_mersenne_temp_size(ctx, num_size);
+	u64* temp = __chonky_calloc(temp_size + n, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate mersenne buffers.");
+		return NULL;
+	}
+	
+	// NOTE: Reduced in temp first, as the result can alias the operand
+	u64* rem = temp + temp_size;
+	if (__chonky_mersenne_reduce(ctx, rem, num -> data_64, num_size, temp) == NULL || chonky_reserve(res, n * 8) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+	
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, rem, n);
+	__chonky_trim(res, n);
+	res -> sign = 0;
+	
+	__chonky_free(temp);
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mersenne_reduce(const BigNum* num, const ChonkyMersenne* ctx) {
+	if (!IS_VALID_BIG_NUM(num) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, ctx -> size * 8, 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_mersenne_reduce_into(res, num, ctx) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+	
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mersenne_mul_mod_into(BigNum* res, const BigNum* a, const BigNum* b, const ChonkyMersenne* ctx) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 n = ctx -> size;
+	const u64 a_size = MAX(chonky_real_size_64(a), 1);
+	const u64 b_size = MAX(chonky_real_size_64(b), 1);
+	const u64 temp_size = __chonky_mersenne_temp_size(ctx, a_size + b_size);
+	u64* temp = __chonky_calloc(temp_size + a_size + b_size + n, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate mersenne buffers.");
+		return NULL;
+	}
+	
+	u64* prod = temp + temp_size;
+	u64* rem = prod + a_size + b_size;
+	if (__chonky_limbs_mul(prod, a -> data_64, a_size, b -> data_64, b_size) == NULL ||
+		__chonky_mersenne_reduce(ctx, rem, prod, a_size + b_size, temp) == NULL || chonky_reserve(res, n * 8) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+	
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, rem, n);
+	__chonky_trim(res, n);
+	res -> sign = 0;
+	
+	__chonky_free(temp);
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mersenne_mul_mod(const BigNum* a, const BigNum* b, const ChonkyMersenne* ctx) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, ctx -> size * 8, 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_mersenne_mul_mod_into(res, a, b, ctx) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+	
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mod_mersenne_into(BigNum* res, const BigNum* num, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	ChonkyMersenne* ctx = alloc_chonky_mersenne(mod);
+	if (ctx == NULL) return NULL;
+	BigNum* result = chonky_mersenne_reduce_into(res, num, ctx);
+	dealloc_chonky_mersenne(ctx);
+
+	return result;
+}
+
+EXPORT_FUNCTION BigNum* chonky_mod_mersenne(const BigNum* num, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(chonky_real_size(mod)), 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_mod_mersenne_into(res, num, mod) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+	
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+// NOTE: The modular exponentiations only write the result once done, so it
+// can alias any of the operands, the modulus included.
+EXPORT_FUNCTION BigNum* chonky_pow_mod_into(BigNum* res, const BigNum* num, const BigNum* exp, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod) || !IS_VALID_BIG_NUM(exp)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (is_chonky_zero((BigNum*) mod)) {
+		WARNING_LOG("The modulus must not be zero.");
+		return NULL;
+	}
+
+	if (chonky_reserve(res, chonky_real_size_64(mod) * 8) == NULL) return NULL;
+
+	if (__chonky_pow_mod(res, num, exp, mod) == NULL) return NULL;
+	
+	res -> sign = 0;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_pow_mod(const BigNum* num, const BigNum* exp, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod) || !IS_VALID_BIG_NUM(exp)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(chonky_real_size(mod)), 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_pow_mod_into(res, num, exp, mod) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+	
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_barrett_reduce_into(BigNum* res, const BigNum* num, const ChonkyBarrett* ctx) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
 	}
-	return TRUE;
+
+	const u64 k = ctx -> size;
+	u64* temp = __chonky_calloc(CHONKY_BARRETT_TEMP_SIZE(k) + k, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate barrett buffers.");
+		return NULL;
+	}
+	
+	// NOTE: Reduced in temp first, as the result can alias the operand
+	u64* rem = temp + CHONKY_BARRETT_TEMP_SIZE(k);
+	if (__chonky_barrett_reduce(ctx, rem, num -> data_64, MAX(chonky_real_size_64(num), 1), temp) == NULL || chonky_reserve(res, k * 8) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+	
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, rem, k);
+	__chonky_trim(res, k);
+	res -> sign = 0;
+	
+	__chonky_free(temp);
+
+	return res;
 }
 
-static u8 chonky_dec_divmod(BigNum* num) {
-	u32 rem = 0;
-	const u64 num_size = chonky_real_size(num);
+EXPORT_FUNCTION BigNum* chonky_barrett_reduce(const BigNum* num, const ChonkyBarrett* ctx) {
+	if (!IS_VALID_BIG_NUM(num) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, ctx -> size * 8, 0);
+	if (res == NULL) return NULL;
 
-	for (s64 i = num_size - 1; i >= 0; --i) {
-        u32 cur = (rem << 8) + (num -> data)[i];
-        (num -> data)[i] = cur / 10;
-        rem = cur % 10;
+	if (chonky_barrett_reduce_into(res, num, ctx) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
 	}
+	
+	if (chonky_resize(res, 0)) return NULL;
 
-	return rem;
+	return res;
 }
 
-#define PRINT_CHONKY_NUM(num)     print_chonky_num(#num, num, TRUE)
-#define PRINT_CHONKY_NUM_DEC(num) print_chonky_num(#num, num, FALSE)
-EXPORT_FUNCTION void print_chonky_num(char* name, BigNum* num, bool use_hex) {
-	if (!IS_VALID_BIG_NUM(num)) {
-		WARNING_LOG("Invalid big num.");
-		return;
+EXPORT_FUNCTION BigNum* chonky_barrett_mul_mod_into(BigNum* res, const BigNum* a, const BigNum* b, const ChonkyBarrett* ctx) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 k = ctx -> size;
+	const u64 a_size = MAX(chonky_real_size_64(a), 1);
+	const u64 b_size = MAX(chonky_real_size_64(b), 1);
+	u64* temp = __chonky_calloc(CHONKY_BARRETT_TEMP_SIZE(k) + a_size + b_size + k, sizeof(u64));
+	if (temp == NULL) {
+		WARNING_LOG("Failed to allocate barrett buffers.");
+		return NULL;
 	}
 	
-	const u64 real_size = chonky_real_size(num);
-	printf("%s: %s", name, num -> sign ? "-" : "");
+	u64* prod = temp + CHONKY_BARRETT_TEMP_SIZE(k);
+	u64* rem = prod + a_size + b_size;
+	if (__chonky_limbs_mul(prod, a -> data_64, a_size, b -> data_64, b_size) == NULL ||
+		__chonky_barrett_reduce(ctx, rem, prod, a_size + b_size, temp) == NULL || chonky_reserve(res, k * 8) == NULL) {
+		__chonky_free(temp);
+		return NULL;
+	}
+	
+	__chonky_limbs_zero(res -> data_64, res -> size / 8);
+	__chonky_limbs_copy(res -> data_64, rem, k);
+	__chonky_trim(res, k);
+	res -> sign = 0;
+	
+	__chonky_free(temp);
 
-	if (use_hex) {
-		for (s64 i = real_size - 1; i >= 0; --i) {
-			printf("%02X", (num -> data)[i]);
-		}
-	} else {
-		BigNum* num_dp = dup_chonky_num(num);
-		if (num_dp == NULL) {
-			WARNING_LOG("Failed to dupe the big num.");
-			return;
-		}
+	return res;
+}
 
-		char* buf = calloc(num_dp -> size * 3, sizeof(u8));
-		if (buf == NULL) {
-			dealloc_chonky_num(num_dp);
-			WARNING_LOG("Failed to alloc the buffer.");
-			return;
-		}
+EXPORT_FUNCTION BigNum* chonky_barrett_mul_mod(const BigNum* a, const BigNum* b, const ChonkyBarrett* ctx) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
 
-		for (u64 i = 0; !is_chonky_zero(num_dp); ++i) {
-			buf[i] = chonky_dec_divmod(num_dp) + '0';
-		}
+	BigNum* res = alloc_chonky_num(NULL, ctx -> size * 8, 0);
+	if (res == NULL) return NULL;
 
-		reverse_str(buf);
+	if (chonky_barrett_mul_mod_into(res, a, b, ctx) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
+	
+	if (chonky_resize(res, 0)) return NULL;
 
-		dealloc_chonky_num(num_dp);
+	return res;
+}
 
-		printf("%s", buf);
-		SAFE_FREE(buf);
+EXPORT_FUNCTION BigNum* chonky_pow_mod_montgomery_into(BigNum* res, const BigNum* num, const BigNum* exp, const ChonkyMontgomery* ctx) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(exp) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (chonky_real_size_64(num) > ctx -> size) {
+		WARNING_LOG("The base should not be bigger than the modulus (%llu > %llu limbs).", chonky_real_size_64(num), ctx -> size);
+		return NULL;
 	}
 
-	printf(" (size: %llu, real size: %llu)\n", num -> size, real_size);
+	if (chonky_reserve(res, ctx -> size * 8) == NULL) return NULL;
 
-	return;
+	if (__chonky_pow_mod_montgomery(res, num, exp, ctx) == NULL) return NULL;
+	
+	res -> sign = 0;
+
+	return res;
 }
 
-/// -------------------------------
-///  Internal Operations Functions
-/// -------------------------------
-static BigNum* __chonky_add(BigNum* res, const BigNum* a, const BigNum* b) {
-	const u64 a_size = chonky_real_size_64(a);
-	const u64 b_size = chonky_real_size_64(b);
-	const u64 size = MIN(res -> size / 8, MAX(a_size, b_size) + 1); 
+EXPORT_FUNCTION BigNum* chonky_pow_mod_montgomery(const BigNum* num, const BigNum* exp, const ChonkyMontgomery* ctx) {
+	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(exp) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
 
-	u64 carry = 0;
-	for (u64 i = 0; i < size; ++i) {
-  		const u64 a_val = -((u64) (i < a_size)) & (a -> data_64)[i];
-  		const u64 b_val = -((u64) (i < b_size)) & (b -> data_64)[i];
-		carry = _addcarry_u64(carry, a_val, b_val, res -> data_64 + i);
+	BigNum* res = alloc_chonky_num(NULL, ctx -> size * 8, 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_pow_mod_montgomery_into(res, num, exp, ctx) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
 	}
+	
+	if (chonky_resize(res, 0)) return NULL;
 
 	return res;
 }
 
-static BigNum* __chonky_sub(BigNum* res, const BigNum* a, const BigNum* b) {
-	const u64 a_size = chonky_real_size_64(a);
-	const u64 b_size = chonky_real_size_64(b);
-	const u64 size = MIN(res -> size / 8, MAX(a_size, b_size) + 1); 
+EXPORT_FUNCTION BigNum* chonky_fixed_base_pow_mod_into(BigNum* res, const BigNum* exp, const ChonkyFixedBase* ctx) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(exp) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (!is_chonky_zero((BigNum*) exp) && chonky_bit_size(exp) > ctx -> max_exp_bits) {
+		WARNING_LOG("The exponent is bigger than the table supports (%llu > %llu bits).", chonky_bit_size(exp), ctx -> max_exp_bits);
+		return NULL;
+	}
+
+	if (chonky_reserve(res, ctx -> size * 8) == NULL) return NULL;
+
+	if (__chonky_fixed_base_pow_mod(res, exp, ctx) == NULL) return NULL;
 	
-	u64 carry = 0;
-	for (u64 i = 0; i < size; ++i) {
-        const u64 a_val = -((u64) (i < a_size)) & (a -> data_64)[i];
-  		const u64 b_val = -((u64) (i < b_size)) & (b -> data_64)[i];
-		carry = _subborrow_u64(carry, a_val, b_val, res -> data_64 + i);
+	res -> sign = 0;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_fixed_base_pow_mod(const BigNum* exp, const ChonkyFixedBase* ctx) {
+	if (!IS_VALID_BIG_NUM(exp) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, ctx -> size * 8, 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_fixed_base_pow_mod_into(res, exp, ctx) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
 	}
 	
-	res -> sign = carry;
+	if (chonky_resize(res, 0)) return NULL;
 
-	const u64 mask = -((u64) carry);
-	if (res -> sign) {
-   		for (u64 i = 0; i < size; ++i) {
-  			(res -> data_64)[i] ^= mask;
-  			carry = _addcarry_u64(carry, (res -> data_64)[i], 0, res -> data_64 + i);
-   		}
- 	}
+	return res;
+}
+
+// res = num^d mod p * q, through the exponents and the inverse kept by ctx
+EXPORT_FUNCTION BigNum* chonky_pow_mod_crt_into(BigNum* res, const BigNum* num, const ChonkyCrt* ctx) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	if (chonky_reserve(res, (ctx -> mont_p -> size + ctx -> mont_q -> size) * 8) == NULL) return NULL;
+
+	if (__chonky_pow_mod_crt(res, num, ctx) == NULL) return NULL;
+	
+	res -> sign = 0;
 
 	return res;
 }
 
-CHONKY_FAILABLE static BigNum* __chonky_mul_s(BigNum* res, const BigNum* a, const BigNum* b) {
-	u64 a_size = chonky_real_size_64(a);
-	u64 b_size = chonky_real_size_64(b);
-	u64 size = res -> size / 8;
-	CHONKY_ASSERT(size > (a_size + b_size));
+EXPORT_FUNCTION BigNum* chonky_pow_mod_crt(const BigNum* num, const ChonkyCrt* ctx) {
+	if (!IS_VALID_BIG_NUM(num) || ctx == NULL) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
 
-	BigNum* res_c = alloc_chonky_num(NULL, res -> size, 0);
-	if (res_c == NULL) return NULL;
+	BigNum* res = alloc_chonky_num(NULL, (ctx -> mont_p -> size + ctx -> mont_q -> size) * 8, 0);
+	if (res == NULL) return NULL;
 
-	for (u64 i = 0; i < a_size; ++i) {
-		for (u64 j = 0; j < b_size; ++j) {
-			u128 product = ((u128) (a -> data_64)[i]) * (b -> data_64)[j];
-			u64 carry = _addcarry_u64(0, (res_c -> data_64)[i + j], product & 0xFFFFFFFFFFFFFFFF, res_c -> data_64 + i + j);
-			
-			u64 rem = (product >> 64) & 0xFFFFFFFFFFFFFFFF;
-			carry = _addcarry_u64(carry, (res_c -> data_64)[i + j + 1], rem, res_c -> data_64 + i + j + 1);
-			
-			for (u64 t = i + j + 2; carry && t < size; ++t) {
-				carry = _addcarry_u64(carry, (res_c -> data_64)[t], 0, res_c -> data_64 + t);
-			}
-		}
+	if (chonky_pow_mod_crt_into(res, num, ctx) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
 	}
 	
-	mem_cpy(res -> data, res_c -> data, res -> size);
-	dealloc_chonky_num(res_c);
+	if (chonky_resize(res, 0)) return NULL;
 
 	return res;
 }
 
-/// TODO: Should maybe find a better solution?
-static void __chonky_divstep(u64 size_diff, BigNum* a, const BigNum* b, u64 c) {
-	const u32 _c[2] = { c & 0xFFFFFFFF, (c >> 32) & 0xFFFFFFFF };
+// res = prod nums[i]^exps[i] mod mod, for i in [0, count)
+EXPORT_FUNCTION BigNum* chonky_multi_pow_mod_into(BigNum* res, BigNum** nums, BigNum** exps, u64 count, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(mod) || (count > 0 && (nums == NULL || exps == NULL))) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (is_chonky_zero((BigNum*) mod)) {
+		WARNING_LOG("The modulus must not be zero.");
+		return NULL;
+	}
 
-	u64 i = 0;
-	u64 carry[5] = {0};
-	for (i = 0; i < align_64(chonky_real_size(b)) / 4; ++i) {
-		for (u8 j = 0; j < 2; ++j) {
-			u64 val = (u64) ((u32*) b -> data)[i] * _c[j % 2];
-			carry[j + 3] = _subborrow_u64(carry[j], *((u64*) (a -> data + (i + j) * 4 + size_diff)), val, (u64*) (a -> data + (i + j) * 4 + size_diff));
+	for (u64 i = 0; i < count; ++i) {
+		if (!IS_VALID_BIG_NUM(nums[i]) || !IS_VALID_BIG_NUM(exps[i])) {
+			WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+			return NULL;
 		}
-		carry[0] = carry[2], carry[2] = 0;
-		carry[1] = carry[3], carry[3] = 0;
 	}
 
-	CHONKY_ASSERT(!carry[0] && !carry[1] && !carry[2] && !carry[3] && !carry[4]);
+	if (chonky_reserve(res, chonky_real_size_64(mod) * 8) == NULL) return NULL;
 
-	return;
+	if (__chonky_multi_pow_mod(res, nums, exps, count, mod) == NULL) return NULL;
+	
+	res -> sign = 0;
+
+	return res;
 }
 
-/// TODO: There are some problems when the dividend is less than 8 byte (with
-/// both `a_val` extraction, as well as __chonky_divstep going off bounds)
-CHONKY_FAILABLE static BigNum* __chonky_div(BigNum* quotient, BigNum* remainder, const BigNum* a, const BigNum* b) {
-	// NOTE: We do not support floating point division for now
-	if (chonky_real_size(a) < chonky_real_size(b)) return quotient;
+EXPORT_FUNCTION BigNum* chonky_multi_pow_mod(BigNum** nums, BigNum** exps, u64 count, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	BigNum* res = alloc_chonky_num(NULL, align_64(chonky_real_size(mod)), 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_multi_pow_mod_into(res, nums, exps, count, mod) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
 	
-	BigNum* a_c = alloc_chonky_num(NULL, a -> size + 8, a -> sign);
-	if (a_c == NULL) return NULL;
-	mem_cpy(a_c -> data, a -> data, a -> size);
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+// Baillie-PSW after trial division, followed by rounds of Miller-Rabin over
+// random bases: no composite is known to pass the former, the rounds only
+// make it less likely. The sign is ignored, and failures count as composites.
+EXPORT_FUNCTION bool chonky_is_probable_prime(const BigNum* num, u64 rounds) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return FALSE;
+	}
+
+	return (__chonky_is_probable_prime(num, TRUE, rounds) == 1);
+}
+
+// Rounds of Miller-Rabin over random bases (at least one) after trial division
+EXPORT_FUNCTION bool chonky_miller_rabin(const BigNum* num, u64 rounds) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return FALSE;
+	}
+
+	return (__chonky_is_probable_prime(num, FALSE, MAX(rounds, 1)) == 1);
+}
 
-	BigNum* b_c = dup_chonky_num(b);
-	if (b_c == NULL) {
-		dealloc_chonky_num(a_c);
+// res = a random probable prime (as chonky_is_probable_prime) of exactly bits
+// bits, with the top two set
+EXPORT_FUNCTION BigNum* chonky_gen_prime_into(BigNum* res, u64 bits, u64 rounds) {
+	if (!IS_VALID_BIG_NUM(res)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (bits < 2) {
+		WARNING_LOG("A prime takes at least two bits.");
 		return NULL;
 	}
 
-	a_c -> sign = 0;
-	b_c -> sign = 0;
+	if (chonky_reserve(res, ((bits + 63) / 64) * 8) == NULL) return NULL;
 
-	mem_set(quotient -> data, 0, quotient -> size);
+	if (__chonky_gen_prime(res, bits, rounds) == NULL) return NULL;
+	
+	res -> sign = 0;
 
-	const u64 low_limit = chonky_real_size(b_c) - 1;
-	u64 i = chonky_real_size(a_c) - 1;
+	return res;
+}
 
-	while (!chonky_is_gt(b_c, a_c)) {
-		// Perform the division with the upper components
-		const u8 additional = (low_limit >= 8) ? ((b_c -> data)[low_limit - 8]) && ((b_c -> data)[low_limit - 8] >= (a_c -> data)[i - 7]) : 0;
-		
-		u64 a_val = *((u64*) (a_c -> data + i - 7));
-		u64 b_val = *((u64*) (b_c -> data + low_limit - 7)) + additional;
-		
-		if (i > low_limit && a_val < b_val) {
-			b_val = (b_val >> 8) + 1;
-			i--;
-		}
-		
-		u64 q_hat = a_val / b_val;
-		CHONKY_ASSERT(q_hat != 0);
+EXPORT_FUNCTION BigNum* chonky_gen_prime(u64 bits, u64 rounds) {
+	BigNum* res = alloc_chonky_num(NULL, ((bits + 63) / 64) * 8, 0);
+	if (res == NULL) return NULL;
 
-		__chonky_divstep(i - low_limit, a_c, b_c, q_hat);
-		
-		*((u64*) (quotient -> data + i - low_limit)) += q_hat;
-		i = chonky_real_size(a_c) - 1;
+	if (chonky_gen_prime_into(res, bits, rounds) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
 	}
 	
-	if (remainder != NULL) {
-		mem_cpy(remainder -> data, a_c -> data, remainder -> size);
+	if (chonky_resize(res, 0)) return NULL;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_pow_mod_mersenne_into(BigNum* res, const BigNum* num, const BigNum* exp, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod) || !IS_VALID_BIG_NUM(exp)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
 	}
 
-	DEALLOC_CHONKY_NUMS(a_c, b_c);
+	ChonkyMersenne* ctx = alloc_chonky_mersenne(mod);
+	if (ctx == NULL) return NULL;
+
+	if (chonky_reserve(res, ctx -> size * 8) == NULL || __chonky_pow_mod_mersenne(res, num, exp, ctx) == NULL) {
+		dealloc_chonky_mersenne(ctx);
+		return NULL;
+	}
+	
+	dealloc_chonky_mersenne(ctx);
+	res -> sign = 0;
 
-	return quotient;
+	return res;
 }
 
-CHONKY_FAILABLE static BigNum* __chonky_pow(BigNum* res, const BigNum* num, const BigNum* exp) {
-    BigNum* temp = dup_chonky_num(res);
-	if (temp == NULL) return NULL;
-	
-	BigNum* temp_base = alloc_chonky_num(NULL, res -> size, num -> sign);
-	if (temp_base == NULL) {
-		dealloc_chonky_num(temp);
+EXPORT_FUNCTION BigNum* chonky_pow_mod_mersenne(const BigNum* num, const BigNum* exp, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod) || !IS_VALID_BIG_NUM(exp)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
-	}	
+	}
 
-	BigNum* base = alloc_chonky_num(NULL, res -> size, num -> sign);
-	if (base == NULL) {
-		DEALLOC_CHONKY_NUMS(temp, temp_base);
+	BigNum* res = alloc_chonky_num(NULL, align_64(chonky_real_size(mod)), 0);
+	if (res == NULL) return NULL;
+
+	if (chonky_pow_mod_mersenne_into(res, num, exp, mod) == NULL) {
+		dealloc_chonky_num(res);
 		return NULL;
-	}	
+	}
 	
-	mem_set(res -> data, 0, res -> size);
-	*(res -> data) = 1;
-	mem_cpy(base -> data, num -> data, num -> size);
+	if (chonky_resize(res, 0)) return NULL;
 
-	const u64 step_cnt = chonky_real_size(exp);
-	for (u64 i = 0; i < step_cnt; ++i) {
-		const u8 bit_s = (i < step_cnt - 1) ? 8 : bit_size((exp -> data)[i]);
-		for (u8 j = 0; j < bit_s; ++j) {
-			if (GET_BIT((exp -> data)[i], j) == 1) {
-				if (__chonky_mul_s(temp, res, base) == NULL) {
-					DEALLOC_CHONKY_NUMS(base, temp, temp_base);
-					return NULL;
-				}
-				mem_cpy(res -> data, temp -> data, res -> size);
-			}
+	return res;
+}
 
-			if (i == step_cnt - 1 && j == bit_s - 1) break;
+// NOTE: The shifts act on the magnitude and keep the sign, so that chonky_shr
+// truncates toward zero as chonky_div does, while the bitwise operations act
+// on the magnitudes and always give non-negative results.
+EXPORT_FUNCTION BigNum* chonky_shl_into(BigNum* res, const BigNum* num, u64 bit_cnt) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
 
-			if (__chonky_mul_s(temp_base, base, base) == NULL) {
-				DEALLOC_CHONKY_NUMS(base, temp, temp_base);
-				return NULL;
-			}
-			mem_cpy(base -> data, temp_base -> data, base -> size);
-		}
+	const u8 sign = num -> sign;
+	const u64 size = num -> limbs + bit_cnt / 64 + 1;
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	__chonky_shl(res, num, bit_cnt);
+	res -> sign = is_chonky_zero(res) ? 0 : sign;
+
+	return res;
+}
+
+EXPORT_FUNCTION BigNum* chonky_shl(const BigNum* num, u64 bit_cnt) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 size = num -> limbs + bit_cnt / 64 + 1;
+	BigNum* res = alloc_chonky_num(NULL, MAX(size, 1) * 8, 0);
+	if (res == NULL) return NULL;
+	
+	if (chonky_shl_into(res, num, bit_cnt) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
 	}
 	
-	DEALLOC_CHONKY_NUMS(base, temp, temp_base);
+	if (chonky_resize(res, 0)) return NULL;
 
 	return res;
 }
 
-CHONKY_FAILABLE static BigNum* __chonky_mod(BigNum* res, const BigNum* num, const BigNum* base) {
-	if (chonky_is_gt(base, num)) {
-		mem_cpy(res -> data, num -> data, num -> size);
-		return res;
-	} 
+EXPORT_FUNCTION BigNum* chonky_shr_into(BigNum* res, const BigNum* num, u64 bit_cnt) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
 
-	BigNum* quotient = alloc_chonky_num(NULL, align_64(MAX(num -> size, base -> size)), 0);
-	if (quotient == NULL) return NULL;
-	
-	__chonky_div(quotient, res, num, base);
+	const u8 sign = num -> sign;
+	const u64 size = (num -> limbs > bit_cnt / 64) ? num -> limbs - bit_cnt / 64 : 0;
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	__chonky_shr(res, num, bit_cnt);
+	res -> sign = is_chonky_zero(res) ? 0 : sign;
 
-	DEALLOC_CHONKY_NUMS(quotient);
-	
 	return res;
 }
 
-static BigNum* __chonky_mask(BigNum* res, BigNum* num, const u64 bit_cnt) {
-	const u64 bits_rem = bit_cnt % 8;
-	const u64 byte_cnt = (bit_cnt - bits_rem) / 8;
-	
-	mem_set(res -> data, 0, res -> size);
-
-	for (u64 i = 0; i < byte_cnt; ++i) {
-		(res -> data)[i] = (num -> data)[i] & 0xFF;
+EXPORT_FUNCTION BigNum* chonky_shr(const BigNum* num, u64 bit_cnt) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
 	}
 
-	if (bits_rem) {
-		(res -> data)[byte_cnt] = (num -> data)[byte_cnt] & ((1 << bits_rem) - 1);
+	const u64 size = (num -> limbs > bit_cnt / 64) ? num -> limbs - bit_cnt / 64 : 0;
+	BigNum* res = alloc_chonky_num(NULL, MAX(size, 1) * 8, 0);
+	if (res == NULL) return NULL;
+	
+	if (chonky_shr_into(res, num, bit_cnt) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
 	}
+	
+	if (chonky_resize(res, 0)) return NULL;
 
 	return res;
 }
 
-// TODO: Should probably alert the user that the given number is a bad general
-// mersenne prime, if the factor is too near to the max exponent of the prime
-// in polynomial form
-CHONKY_FAILABLE static BigNum* get_mersenne_factor(const BigNum* num, BigNum* mersenne_c) {
-	const u64 num_bit_size = chonky_bit_size(num);
-	
-	BigNum* temp = alloc_chonky_num(NULL, (num_bit_size / 8) + 8, 0);
-	if (temp == NULL) return NULL;
+// Keeps the lowest bit_cnt bits of the magnitude
+EXPORT_FUNCTION BigNum* chonky_mask_into(BigNum* res, const BigNum* num, u64 bit_cnt) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
 
-	const u64 num_bit_size_rem = num_bit_size % 8;
-	(temp -> data)[(num_bit_size - num_bit_size_rem) / 8] = 1 << num_bit_size_rem;
-		
-	__chonky_sub(mersenne_c, temp, num);
+	const u64 size = MIN(num -> limbs, (bit_cnt + 63) / 64);
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
 
-	dealloc_chonky_num(temp);
+	__chonky_mask(res, num, bit_cnt);
+	res -> sign = 0;
 
-	return mersenne_c;
+	return res;
 }
 
-CHONKY_FAILABLE static BigNum* __chonky_mod_mersenne(BigNum* res, const BigNum* num, const BigNum* base) {
-	if (chonky_is_gt(base, num)) {
-		mem_cpy(res -> data, num -> data, base -> size);
-		return res;
-	} else if (chonky_real_size_64(base) == chonky_real_size_64(num)) {
-		__chonky_mod(res, num, base);
-		return res;	
+EXPORT_FUNCTION BigNum* chonky_mask(const BigNum* num, u64 bit_cnt) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
 	}
-	
-	if (get_mersenne_factor(base, res) == NULL) return NULL;
-	
-	const u64 base_size = chonky_real_size_64(base);
-	BigNum* temp_res = alloc_chonky_num(NULL, num -> size + (num -> size - base_size * 8), 0);
-	if (temp_res == NULL) return NULL;
-	
-	mem_cpy(temp_res -> data, num -> data, num -> size);
 
-	const u64 base_bit_cnt = chonky_bit_size(base);
-	BigNum* low = alloc_chonky_num(NULL, base_size * 8, 0);
-	if (low == NULL) {
-		dealloc_chonky_num(temp_res);
+	const u64 size = MIN(num -> limbs, (bit_cnt + 63) / 64);
+	BigNum* res = alloc_chonky_num(NULL, MAX(size, 1) * 8, 0);
+	if (res == NULL) return NULL;
+	
+	if (chonky_mask_into(res, num, bit_cnt) == NULL) {
+		dealloc_chonky_num(res);
 		return NULL;
 	}
+	
+	if (chonky_resize(res, 0)) return NULL;
 
-	while (chonky_is_gt(temp_res, base)) {
-		__chonky_mask(low, temp_res, base_bit_cnt);
-		__chonky_rshift(temp_res, base_bit_cnt);
-		
-		if (!is_chonky_zero(temp_res)) {
-			if (__chonky_mul_s(temp_res, temp_res, res) == NULL) {
-				DEALLOC_CHONKY_NUMS(low, temp_res);
-				return NULL;
-			}
-			__chonky_add(temp_res, temp_res, low);
-		} else {
-			__chonky_sub(temp_res, low, base);
-		}
+	return res;
+}
+
+// Flips the lowest bit_cnt bits of the magnitude, clearing the others
+EXPORT_FUNCTION BigNum* chonky_not_into(BigNum* res, const BigNum* num, u64 bit_cnt) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
 	}
 
-	mem_cpy(res -> data, temp_res -> data, res -> size);
+	const u64 size = (bit_cnt + 63) / 64;
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
 
-	DEALLOC_CHONKY_NUMS(low, temp_res);
+	__chonky_not(res, num, bit_cnt);
+	res -> sign = 0;
 
 	return res;
 }
 
-// TODO: There is probably also some method to reduce the exponent
-CHONKY_FAILABLE static BigNum* __chonky_pow_mod(BigNum* res, const BigNum* num, const BigNum* exp, const BigNum* mod_base) {
- 	BigNum* temp = alloc_chonky_num(NULL, res -> size * 2 + 8, res -> sign);
-	if (temp == NULL) return NULL;
-
-	BigNum* temp_base = alloc_chonky_num(NULL, res -> size * 2 + 8, num -> sign);
-	if (temp_base == NULL) {
-		dealloc_chonky_num(temp);
+EXPORT_FUNCTION BigNum* chonky_not(const BigNum* num, u64 bit_cnt) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
-	}	
+	}
 
-	BigNum* base = alloc_chonky_num(NULL, res -> size, num -> sign);
-	if (base == NULL) {
-		DEALLOC_CHONKY_NUMS(temp, temp_base);
+	const u64 size = (bit_cnt + 63) / 64;
+	BigNum* res = alloc_chonky_num(NULL, MAX(size, 1) * 8, 0);
+	if (res == NULL) return NULL;
+	
+	if (chonky_not_into(res, num, bit_cnt) == NULL) {
+		dealloc_chonky_num(res);
 		return NULL;
-	}	
+	}
 	
-	mem_set(res -> data, 0, res -> size);
-	*(res -> data) = 1;
-
-	if (chonky_is_gt(num, mod_base)) __chonky_mod(base, num, mod_base);
-	else mem_cpy(base -> data, num -> data, num -> size);
+	if (chonky_resize(res, 0)) return NULL;
 
-	const u64 step_cnt = chonky_real_size(exp);
-	for (u64 i = 0; i < step_cnt; ++i) {
-		const u8 bit_s = (i < step_cnt - 1) ? 8 : bit_size((exp -> data)[i]);
-		for (u8 j = 0; j < bit_s; ++j) {
-			if (GET_BIT((exp -> data)[i], j) == 1) {
-				if (__chonky_mul_s(temp, res, base) == NULL) {
-					DEALLOC_CHONKY_NUMS(base, temp, temp_base);
-					return NULL;
-				}
-				
-				if (chonky_is_gt(temp, mod_base)) {
-					if (__chonky_mod(res, temp, mod_base) == NULL) {
-						DEALLOC_CHONKY_NUMS(base, temp, temp_base);
-						return NULL;
-					}
-				} else {
-					mem_cpy(res -> data, temp -> data, res -> size);
-				}
-			}
+	return res;
+}
 
-			if (__chonky_mul_s(temp_base, base, base) == NULL) {
-				DEALLOC_CHONKY_NUMS(base, temp, temp_base);
-				return NULL;
-			}
-			
-			if (chonky_is_gt(temp_base, mod_base)) {
-				if (__chonky_mod(base, temp_base, mod_base) == NULL) {
-					DEALLOC_CHONKY_NUMS(base, temp, temp_base);
-					return NULL;
-				}
-			} else {
-				mem_cpy(base -> data, temp_base -> data, base -> size);
-			}
-		}
+EXPORT_FUNCTION BigNum* chonky_and_into(BigNum* res, const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
 	}
-	
-	DEALLOC_CHONKY_NUMS(base, temp, temp_base);
+
+	const u64 size = MIN(a -> limbs, b -> limbs);
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	__chonky_and(res, a, b);
+	res -> sign = 0;
 
 	return res;
 }
 
-// TODO: There is probably also some method to reduce the exponent
-CHONKY_FAILABLE static BigNum* __chonky_pow_mod_mersenne(BigNum* res, const BigNum* num, const BigNum* exp, const BigNum* mod_base) {
- 	BigNum* temp = alloc_chonky_num(NULL, res -> size * 2 + 8, res -> sign);
-	if (temp == NULL) return NULL;
-
-	BigNum* temp_base = alloc_chonky_num(NULL, res -> size * 2 + 8, num -> sign);
-	if (temp_base == NULL) {
-		dealloc_chonky_num(temp);
+EXPORT_FUNCTION BigNum* chonky_and(const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
-	}	
+	}
 
-	BigNum* base = alloc_chonky_num(NULL, res -> size, num -> sign);
-	if (base == NULL) {
-		DEALLOC_CHONKY_NUMS(temp, temp_base);
-		return NULL;
-	}	
+	const u64 size = MIN(a -> limbs, b -> limbs);
+	BigNum* res = alloc_chonky_num(NULL, MAX(size, 1) * 8, 0);
+	if (res == NULL) return NULL;
 	
-	mem_set(res -> data, 0, res -> size);
-	*(res -> data) = 1;
+	if (chonky_and_into(res, a, b) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
+	}
 	
-	if (chonky_is_gt(num, mod_base)) __chonky_mod_mersenne(base, num, mod_base);
-	else mem_cpy(base -> data, num -> data, num -> size);
+	if (chonky_resize(res, 0)) return NULL;
 
-	for (u64 i = 0; i < chonky_real_size(exp); ++i) {
-		const u8 bit_s = (i < chonky_real_size(exp) - 1) ? 8 : bit_size((exp -> data)[i]);
-		for (u8 j = 0; j < bit_s; ++j) {
-			if (GET_BIT((exp -> data)[i], j) == 1) {
-				if (__chonky_mul_s(temp, res, base) == NULL) {
-					DEALLOC_CHONKY_NUMS(temp, temp_base, base);
-					return NULL;
-				}
-				
-				if (chonky_is_gt(temp, mod_base)) {
-					if (__chonky_mod_mersenne(res, temp, mod_base) == NULL) {
-						DEALLOC_CHONKY_NUMS(temp, temp_base, base);
-						return NULL;
-					}
-				} else {
-					mem_cpy(res -> data, temp -> data, res -> size);
-				}
-			}
+	return res;
+}
 
-			if (__chonky_mul_s(temp_base, base, base) == NULL) {
-				DEALLOC_CHONKY_NUMS(temp, temp_base, base);
-				return NULL;
-			}
-			
-			if (chonky_is_gt(temp_base, mod_base)) {
-				if (__chonky_mod_mersenne(base, temp_base, mod_base) == NULL) {
-					DEALLOC_CHONKY_NUMS(temp, temp_base, base);
-					return NULL;
-				}
-			} else {
-				mem_cpy(base -> data, temp_base -> data, base -> size);
-			}
-		}
+EXPORT_FUNCTION BigNum* chonky_or_into(BigNum* res, const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
 	}
-	
-	DEALLOC_CHONKY_NUMS(base, temp, temp_base);
+
+	const u64 size = MAX(a -> limbs, b -> limbs);
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	__chonky_or_xor(res, a, b, FALSE);
+	res -> sign = 0;
 
 	return res;
 }
 
-/// -----------------------------------------
-///  BigNum Public Functions
-/// -----------------------------------------
-EXPORT_FUNCTION BigNum* chonky_add(const BigNum* a, const BigNum* b) {
+EXPORT_FUNCTION BigNum* chonky_or(const BigNum* a, const BigNum* b) {
 	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
 
-	BigNum* res = alloc_chonky_num(NULL, align_64(MAX(a -> size, b -> size) + 1), 0);
+	const u64 size = MAX(a -> limbs, b -> limbs);
+	BigNum* res = alloc_chonky_num(NULL, MAX(size, 1) * 8, 0);
 	if (res == NULL) return NULL;
 	
-	if ((a -> sign && !b -> sign) || (!a -> sign && b -> sign)) {
-		const BigNum* minuend = a -> sign ? b : a;
-		const BigNum* subtraend = a -> sign ? a : b;
-		res = __chonky_sub(res, minuend, subtraend);
-	} else {
-   		res -> sign = a -> sign && b -> sign;
-   		res = __chonky_add(res, a, b);
+	if (chonky_or_into(res, a, b) == NULL) {
+		dealloc_chonky_num(res);
+		return NULL;
 	}
+	
+	if (chonky_resize(res, 0)) return NULL;
+
 	return res;
 }
 
-EXPORT_FUNCTION BigNum* chonky_sub(const BigNum* a, const BigNum* b) {
-	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+EXPORT_FUNCTION BigNum* chonky_xor_into(BigNum* res, const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
 
-	BigNum* minuend = dup_chonky_num(b);
-	if (minuend == NULL) return NULL;
-	
-	minuend -> sign = !(b -> sign);
-	
-	BigNum* res = chonky_add(a, minuend);
-	dealloc_chonky_num(minuend);
-	
+	const u64 size = MAX(a -> limbs, b -> limbs);
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	__chonky_or_xor(res, a, b, TRUE);
+	res -> sign = 0;
+
 	return res;
 }
 
-EXPORT_FUNCTION BigNum* chonky_mul(const BigNum* a, const BigNum* b) {
+EXPORT_FUNCTION BigNum* chonky_xor(const BigNum* a, const BigNum* b) {
 	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
 
-	BigNum* res = alloc_chonky_num(NULL, align_64(a -> size + b -> size) + 8, 0);
+	const u64 size = MAX(a -> limbs, b -> limbs);
+	BigNum* res = alloc_chonky_num(NULL, MAX(size, 1) * 8, 0);
 	if (res == NULL) return NULL;
 	
-	res -> sign = a -> sign | b -> sign;
-	if (__chonky_mul_s(res, a, b) == NULL) {
+	if (chonky_xor_into(res, a, b) == NULL) {
 		dealloc_chonky_num(res);
 		return NULL;
 	}
+	
+	if (chonky_resize(res, 0)) return NULL;
 
 	return res;
 }
 
-EXPORT_FUNCTION BigNum* chonky_div(const BigNum* a, const BigNum* b) {
+EXPORT_FUNCTION u64 chonky_popcount(const BigNum* num) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return 0;
+	}
+
+	u64 count = 0;
+	for (u64 i = 0; i < num -> limbs; ++i) count += __builtin_popcountll((num -> data_64)[i]);
+
+	return count;
+}
+
+// Index of the lowest set bit of the magnitude, -1 when it is zero
+EXPORT_FUNCTION s64 chonky_lowest_bit(const BigNum* num) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return -1;
+	}
+
+	for (u64 i = 0; i < num -> limbs; ++i) {
+		if ((num -> data_64)[i]) return i * 64 + __builtin_ctzll((num -> data_64)[i]);
+	}
+
+	return -1;
+}
+
+// Index of the highest set bit of the magnitude, -1 when it is zero
+EXPORT_FUNCTION s64 chonky_highest_bit(const BigNum* num) {
+	if (!IS_VALID_BIG_NUM(num)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return -1;
+	}
+
+	return (s64) chonky_bit_size(num) - 1;
+}
+
+EXPORT_FUNCTION BigNum* chonky_gcd_into(BigNum* res, const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	}
+
+	const u64 size = MAX(MAX(a -> limbs, b -> limbs), 1);
+	if (chonky_reserve(res, size * 8) == NULL) return NULL;
+
+	return __chonky_gcdext(res, NULL, a, b);
+}
+
+EXPORT_FUNCTION BigNum* chonky_gcd(const BigNum* a, const BigNum* b) {
 	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
 
-	BigNum* res = alloc_chonky_num(NULL, align_64(MAX(a -> size, b -> size)), 0);
+	BigNum* res = alloc_chonky_num(NULL, MAX(MAX(a -> limbs, b -> limbs), 1) * 8, 0);
 	if (res == NULL) return NULL;
-
-	res -> sign = a -> sign | b -> sign;
 	
-	if (__chonky_div(res, NULL, a, b) == NULL) {
+	if (chonky_gcd_into(res, a, b) == NULL) {
 		dealloc_chonky_num(res);
 		return NULL;
 	}
-	
-	if (chonky_resize(res, 0)) return NULL;
 
 	return res;
 }
 
-EXPORT_FUNCTION BigNum* chonky_pow(const BigNum* num, const BigNum* exp) {
-	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(exp)) {
+// g = gcd(a, b) = a * x + b * y, with g non-negative, either of x and y can be NULL.
+// NOTE: The cofactors are computed before writing any result, so that they
+// can alias the operands, but they must be different numbers.
+EXPORT_FUNCTION BigNum* chonky_gcd_ext_into(BigNum* g, BigNum* x, BigNum* y, const BigNum* a, const BigNum* b) {
+	if (!IS_VALID_BIG_NUM(g) || (x != NULL && !IS_VALID_BIG_NUM(x)) || (y != NULL && !IS_VALID_BIG_NUM(y)) || !IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
-	} else if (chonky_real_size(exp) > 4) {
-		WARNING_LOG("Pure exponentiation, does not allow for exponent with more than four bytes (%llu).", chonky_real_size(exp));
+	} else if (g == x || g == y || (x != NULL && x == y)) {
+		WARNING_LOG("The gcd and the cofactors must be different numbers.");
 		return NULL;
 	}
 
-	const u64 size = chonky_real_size(num) * __chonky_spow(2, chonky_real_size(exp) * 8);
-	BigNum* res = alloc_chonky_num(NULL, align_64(size), 0);
-	if (res == NULL) return NULL;
+	// NOTE: All of them are as big as s * |a|, as the generic additions read
+	// their operands up to the size of the result
+	const u64 size = (2 * MAX(MAX(a -> limbs, b -> limbs), 1) + 3) * 8;
+	BigNum* g_num = alloc_chonky_num(NULL, size, 0);
+	BigNum* s_num = alloc_chonky_num(NULL, size, 0);
+	BigNum* t_num = alloc_chonky_num(NULL, size, 0);
+	if (g_num == NULL || s_num == NULL || t_num == NULL) {
+		if (g_num != NULL) dealloc_chonky_num(g_num);
+		if (s_num != NULL) dealloc_chonky_num(s_num);
+		if (t_num != NULL) dealloc_chonky_num(t_num);
+		return NULL;
+	}
 
-	res -> sign = num -> sign * ((exp -> data)[0] & 0x01);
-	if (__chonky_pow(res, num, exp) == NULL) {
-		dealloc_chonky_num(res);
+	// |b| * t = g - s * |a|, an exact division (t = 0 when b = 0)
+	const BigNum abs_a = STATIC_BIG_NUM(a -> data, a -> size, 0);
+	const BigNum abs_b = STATIC_BIG_NUM(b -> data, b -> size, 0);
+	bool is_failed = (__chonky_gcdext(g_num, s_num, a, b) == NULL);
+	if (!is_failed && y != NULL && !is_chonky_zero(b)) {
+		is_failed = (chonky_mul_into(t_num, s_num, &abs_a) == NULL || chonky_sub_into(t_num, g_num, t_num) == NULL || chonky_div_into(t_num, t_num, &abs_b) == NULL);
+	}
+
+	const u8 x_sign = is_chonky_zero(s_num) ? 0 : s_num -> sign ^ a -> sign;
+	const u8 y_sign = is_chonky_zero(t_num) ? 0 : t_num -> sign ^ b -> sign;
+	is_failed = is_failed || chonky_reserve(g, g_num -> limbs * 8) == NULL;
+	is_failed = is_failed || (x != NULL && chonky_reserve(x, s_num -> limbs * 8) == NULL);
+	is_failed = is_failed || (y != NULL && chonky_reserve(y, t_num -> limbs * 8) == NULL);
+	if (is_failed) {
+		DEALLOC_CHONKY_NUMS(g_num, s_num, t_num);
 		return NULL;
 	}
+
+	__chonky_limbs_zero(g -> data_64, g -> size / 8);
+	__chonky_limbs_copy(g -> data_64, g_num -> data_64, g_num -> limbs);
+	__chonky_trim(g, g_num -> limbs);
+	g -> sign = 0;
+
+	if (x != NULL) {
+		__chonky_limbs_zero(x -> data_64, x -> size / 8);
+		__chonky_limbs_copy(x -> data_64, s_num -> data_64, s_num -> limbs);
+		__chonky_trim(x, s_num -> limbs);
+		x -> sign = x_sign;
+	}
 	
-	if (chonky_resize(res, 0)) return NULL;
+	if (y != NULL) {
+		__chonky_limbs_zero(y -> data_64, y -> size / 8);
+		__chonky_limbs_copy(y -> data_64, t_num -> data_64, t_num -> limbs);
+		__chonky_trim(y, t_num -> limbs);
+		y -> sign = y_sign;
+	}
 
-	return res;
+	DEALLOC_CHONKY_NUMS(g_num, s_num, t_num);
+
+	return g;
 }
 
-EXPORT_FUNCTION BigNum* chonky_mod(const BigNum* num, const BigNum* mod) {
-	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod)) {
+EXPORT_FUNCTION BigNum* chonky_gcd_ext(const BigNum* a, const BigNum* b, BigNum** x, BigNum** y) {
+	if (!IS_VALID_BIG_NUM(a) || !IS_VALID_BIG_NUM(b)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
 
-	const u64 size = chonky_real_size(mod);
-	BigNum* res = alloc_chonky_num(NULL, align_64(size), 0);
-	if (res == NULL) return NULL;
+	const u64 size = MAX(MAX(a -> limbs, b -> limbs), 1) * 8;
+	BigNum* g = alloc_chonky_num(NULL, size, 0);
+	BigNum* x_num = (x != NULL) ? alloc_chonky_num(NULL, size, 0) : NULL;
+	BigNum* y_num = (y != NULL) ? alloc_chonky_num(NULL, size, 0) : NULL;
+	if (g == NULL || (x != NULL && x_num == NULL) || (y != NULL && y_num == NULL) || chonky_gcd_ext_into(g, x_num, y_num, a, b) == NULL) {
+		if (g != NULL) dealloc_chonky_num(g);
+		if (x_num != NULL) dealloc_chonky_num(x_num);
+		if (y_num != NULL) dealloc_chonky_num(y_num);
+		return NULL;
+	}
 
-	if (__chonky_mod(res, num, mod) == NULL) {
-		dealloc_chonky_num(res);
+	if (x != NULL) *x = x_num;
+	if (y != NULL) *y = y_num;
+
+	return g;
+}
+
+// res = num^-1 mod |mod|, in [0, |mod|), NULL when num and mod are not coprime
+EXPORT_FUNCTION BigNum* chonky_invert_into(BigNum* res, const BigNum* num, const BigNum* mod) {
+	if (!IS_VALID_BIG_NUM(res) || !IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
+		return NULL;
+	} else if (is_chonky_zero(mod)) {
+		WARNING_LOG("Division by zero.");
 		return NULL;
 	}
-	
-	if (chonky_resize(res, 0)) return NULL;
 
-	return res;
+	if (chonky_reserve(res, mod -> limbs * 8) == NULL) return NULL;
+
+	return __chonky_invert(res, num, mod);
 }
 
-EXPORT_FUNCTION BigNum* chonky_mod_mersenne(const BigNum* num, const BigNum* mod) {
+EXPORT_FUNCTION BigNum* chonky_invert(const BigNum* num, const BigNum* mod) {
 	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
 
-	const u64 size = chonky_real_size(mod);
-	BigNum* res = alloc_chonky_num(NULL, align_64(size), 0);
+	BigNum* res = alloc_chonky_num(NULL, MAX(mod -> limbs, 1) * 8, 0);
 	if (res == NULL) return NULL;
-
-	if (__chonky_mod_mersenne(res, num, mod) == NULL) {
+	
+	if (chonky_invert_into(res, num, mod) == NULL) {
 		dealloc_chonky_num(res);
 		return NULL;
 	}
-	
-	if (chonky_resize(res, 0)) return NULL;
 
 	return res;
 }
 
-EXPORT_FUNCTION BigNum* chonky_pow_mod(const BigNum* num, const BigNum* exp, const BigNum* mod) {
-	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod) || !IS_VALID_BIG_NUM(exp)) {
+// NOTE: The batch variants take arrays of `count` elements, processed by
+// groups of SIMD lanes when AVX2 or AVX-512 are available (one by one
+// otherwise). Each result is caller owned as for the `_into` variants, and can
+// only alias the operands with its same index.
+EXPORT_FUNCTION BigNum** chonky_add_batch(BigNum** res, BigNum** a, BigNum** b, u64 count) {
+	if (!__chonky_batch_is_valid(res, count) || !__chonky_batch_is_valid(a, count) || !__chonky_batch_is_valid(b, count)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
 
-	const u64 size = chonky_real_size(mod);
-	BigNum* res = alloc_chonky_num(NULL, align_64(size), 0);
-	if (res == NULL) return NULL;
+	const ChonkyBatchOps ops = __chonky_batch_ops();
+	if (ops.lanes == 0) {
+		for (u64 i = 0; i < count; ++i) {
+			if (chonky_add_into(res[i], a[i], b[i]) == NULL) return NULL;
+		}
+		return res;
+	}
 
-	if (__chonky_pow_mod(res, num, exp, mod) == NULL) {
-		dealloc_chonky_num(res);
-		return NULL;
+	for (u64 i = 0; i < count; i += ops.lanes) {
+		if (__chonky_batch_add(&ops, res + i, a + i, b + i, MIN(ops.lanes, count - i)) == NULL) return NULL;
 	}
-	
-	if (chonky_resize(res, 0)) return NULL;
 
 	return res;
 }
 
-EXPORT_FUNCTION BigNum* chonky_pow_mod_mersenne(const BigNum* num, const BigNum* exp, const BigNum* mod) {
-	if (!IS_VALID_BIG_NUM(num) || !IS_VALID_BIG_NUM(mod) || !IS_VALID_BIG_NUM(exp)) {
+EXPORT_FUNCTION BigNum** chonky_mul_batch(BigNum** res, BigNum** a, BigNum** b, u64 count) {
+	if (!__chonky_batch_is_valid(res, count) || !__chonky_batch_is_valid(a, count) || !__chonky_batch_is_valid(b, count)) {
 		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
 
-	const u64 size = chonky_real_size(mod);
-	BigNum* res = alloc_chonky_num(NULL, align_64(size), 0);
-	if (res == NULL) return NULL;
+	const ChonkyBatchOps ops = __chonky_batch_ops();
+	if (ops.lanes == 0) {
+		for (u64 i = 0; i < count; ++i) {
+			if (chonky_mul_into(res[i], a[i], b[i]) == NULL) return NULL;
+		}
+		return res;
+	}
 
-	if (__chonky_pow_mod_mersenne(res, num, exp, mod) == NULL) {
-		dealloc_chonky_num(res);
+	for (u64 i = 0; i < count; i += ops.lanes) {
+		if (__chonky_batch_mul(&ops, res + i, a + i, b + i, MIN(ops.lanes, count - i)) == NULL) return NULL;
+	}
+
+	return res;
+}
+
+// NOTE: The lanes need odd moduli, the even ones go through chonky_pow_mod_into
+EXPORT_FUNCTION BigNum** chonky_pow_mod_batch(BigNum** res, BigNum** num, BigNum** exp, BigNum** mod, u64 count) {
+	if (!__chonky_batch_is_valid(res, count) || !__chonky_batch_is_valid(num, count) || !__chonky_batch_is_valid(exp, count) || !__chonky_batch_is_valid(mod, count)) {
+		WARNING_LOG("Invalid parameters, should not contain NULL pointers.");
 		return NULL;
 	}
+
+	for (u64 i = 0; i < count; ++i) {
+		if (is_chonky_zero(mod[i])) {
+			WARNING_LOG("The modulus must not be zero (element %llu).", i);
+			return NULL;
+		}
+	}
+
+	const ChonkyBatchOps ops = __chonky_batch_ops();
 	
-	if (chonky_resize(res, 0)) return NULL;
+	BigNum* group[4][CHONKY_BATCH_MAX_LANES_] = {0};
+	u64 group_size = 0;
+	for (u64 i = 0; i < count; ++i) {
+		if (ops.lanes == 0 || !((mod[i] -> data_64)[0] & 1)) {
+			if (chonky_pow_mod_into(res[i], num[i], exp[i], mod[i]) == NULL) return NULL;
+			continue;
+		}
+
+		group[0][group_size] = res[i];
+		group[1][group_size] = num[i];
+		group[2][group_size] = exp[i];
+		group[3][group_size] = mod[i];
+		
+		if (++group_size == ops.lanes) {
+			if (__chonky_batch_pow_mod(&ops, group[0], group[1], group[2], group[3], group_size) == NULL) return NULL;
+			group_size = 0;
+		}
+	}
+
+	if (group_size > 0 && __chonky_batch_pow_mod(&ops, group[0], group[1], group[2], group[3], group_size) == NULL) return NULL;
 
 	return res;
 }
 
 #endif //_CHONKY_NUMS_H_
-
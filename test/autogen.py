@@ -85,6 +85,7 @@ def cfile_to_classname(filename: str) -> str:
 
 class Autogen:
     structs_types = []
+    defines = {}
     anon_cnt = ord('A')
 
     def __init__(self, c_files, py_file):
@@ -181,6 +182,16 @@ class Autogen:
             field_name = line.split(" ")[-1].replace(";", "").strip()
             field_type = line.split(field_name)[0].strip()
             field_type = ctype_from_string(field_type, self.structs_types)
+            
+            # Fixed size arrays, the length can be a constant defined before
+            array_match = re.match(r"(\w+)\[(\w+)\]$", field_name)
+            if array_match:
+                field_name, array_len = array_match.groups()
+                array_len = self.defines.get(array_len, array_len)
+                if not array_len.isdigit():
+                    raise Exception(f"'{array_len}' is not a known array length")
+                field_type = f"{field_type} * {array_len}"
+            
             if (field_type == "ctypes.Union"):
                 size, union_name, is_anon, union_buf = self.generate_union(lines[idx:])
                 idx += size
@@ -324,7 +335,10 @@ class Autogen:
         function_prototypes = []
         for i in range(0, len(lines)):
             line = lines[i]
-            if line.startswith("EXPORT_FUNCTION"):
+            define_match = re.match(r"\s*#define\s+(\w+)\s+\(?(\d+)\)?\s*$", line)
+            if define_match:
+                self.defines[define_match.group(1)] = define_match.group(2)
+            elif line.startswith("EXPORT_FUNCTION"):
                 line = line.replace("EXPORT_FUNCTION", "").strip()
                 py_class = py_file.replace(".py", "")
                 function_prototypes.append(self.parse_function(line))
@@ -1,6 +1,6 @@
 # ------------------------------------------------------------
 # THIS FILE IS AUTOGENERATED – DO NOT EDIT MANUALLY
-# Generated on 08-01-2026 by autogen.py
+# Generated on 17-10-2026 by autogen.py
 # From C files: ['../chonky_nums.h']
 # ------------------------------------------------------------
 import ctypes
@@ -11,6 +11,45 @@ class Chonky_nums:
 		self.chonky_nums = ctypes.CDLL("./chonky_nums_py.so")
 		pass
 
+
+class ChonkyPool(ctypes.Structure):
+	_fields_ = [
+		("chunks", ctypes.c_void_p),
+		("large", ctypes.c_void_p),
+		("free_lists", ctypes.c_void_p),
+		("marks", ctypes.c_void_p),
+		("marks_count", ctypes.c_uint64),
+		("chunk_size", ctypes.c_uint64),
+		("serial", ctypes.c_uint64),
+	]
+	_anonymous_ = ()
+
+	def __init__(self, **kwargs):
+		for field_name, _ in self._fields_:
+			setattr(self, field_name, 0)
+		for key, value in kwargs.items():
+			if key in [f[0] for f in self._fields_]:
+				setattr(self, key, value)
+			else:
+				raise TypeError(f"Unknown field: {key}")
+		pass
+
+	def __repr__(self):
+		fields = "\n".join(
+			f"\t{name}: {getattr(self, name)!r}" for name, _ in self._fields_
+		)
+		return f"{self.__class__.__name__}: {{\n{fields}\n}}"
+
+	def __sizeof__():
+		return ctypes.sizeof(ChonkyPool)
+
+	def to_bytes(self):
+		return bytes(ctypes.string_at(ctypes.addressof(self), ctypes.sizeof(self)))
+
+	def hex_dump(self, sep=" "):
+		return sep.join(f"{b:02X}" for b in self.to_bytes())
+
+
 class AnonymousUnionA(ctypes.Union):
 	_fields_ = [
 		("data", ctypes.POINTER(ctypes.c_uint8)),
@@ -21,8 +60,11 @@ class BigNum(ctypes.Structure):
 	_fields_ = [
 		("AnonymousUnionA", AnonymousUnionA),
 		("size", ctypes.c_uint64),
+		("limbs", ctypes.c_uint64),
 		("sign", ctypes.c_uint8),
 		("is_freeable", ctypes.c_uint8),
+		("is_pooled", ctypes.c_uint8),
+		("inline_limbs", ctypes.c_uint64 * 4),
 	]
 	_anonymous_ = ("AnonymousUnionA",)
 
@@ -52,11 +94,241 @@ class BigNum(ctypes.Structure):
 		return sep.join(f"{b:02X}" for b in self.to_bytes())
 
 
+
+class ChonkyMontgomery(ctypes.Structure):
+	_fields_ = [
+		("mod", ctypes.POINTER(BigNum)),
+		("r2", ctypes.POINTER(BigNum)),
+		("m_inv", ctypes.c_uint64),
+		("size", ctypes.c_uint64),
+		("mod_digits", ctypes.POINTER(ctypes.c_uint64)),
+		("digits", ctypes.c_uint64),
+		("is_pooled", ctypes.c_uint8),
+	]
+	_anonymous_ = ()
+
+	def __init__(self, **kwargs):
+		for field_name, _ in self._fields_:
+			setattr(self, field_name, 0)
+		for key, value in kwargs.items():
+			if key in [f[0] for f in self._fields_]:
+				setattr(self, key, value)
+			else:
+				raise TypeError(f"Unknown field: {key}")
+		pass
+
+	def __repr__(self):
+		fields = "\n".join(
+			f"\t{name}: {getattr(self, name)!r}" for name, _ in self._fields_
+		)
+		return f"{self.__class__.__name__}: {{\n{fields}\n}}"
+
+	def __sizeof__():
+		return ctypes.sizeof(ChonkyMontgomery)
+
+	def to_bytes(self):
+		return bytes(ctypes.string_at(ctypes.addressof(self), ctypes.sizeof(self)))
+
+	def hex_dump(self, sep=" "):
+		return sep.join(f"{b:02X}" for b in self.to_bytes())
+
+
+
+class ChonkyBarrett(ctypes.Structure):
+	_fields_ = [
+		("mod", ctypes.POINTER(BigNum)),
+		("mu", ctypes.POINTER(BigNum)),
+		("size", ctypes.c_uint64),
+		("is_pooled", ctypes.c_uint8),
+	]
+	_anonymous_ = ()
+
+	def __init__(self, **kwargs):
+		for field_name, _ in self._fields_:
+			setattr(self, field_name, 0)
+		for key, value in kwargs.items():
+			if key in [f[0] for f in self._fields_]:
+				setattr(self, key, value)
+			else:
+				raise TypeError(f"Unknown field: {key}")
+		pass
+
+	def __repr__(self):
+		fields = "\n".join(
+			f"\t{name}: {getattr(self, name)!r}" for name, _ in self._fields_
+		)
+		return f"{self.__class__.__name__}: {{\n{fields}\n}}"
+
+	def __sizeof__():
+		return ctypes.sizeof(ChonkyBarrett)
+
+	def to_bytes(self):
+		return bytes(ctypes.string_at(ctypes.addressof(self), ctypes.sizeof(self)))
+
+	def hex_dump(self, sep=" "):
+		return sep.join(f"{b:02X}" for b in self.to_bytes())
+
+
+
+class ChonkyMersenne(ctypes.Structure):
+	_fields_ = [
+		("mod", ctypes.POINTER(BigNum)),
+		("c", ctypes.POINTER(BigNum)),
+		("barrett", ctypes.POINTER(ChonkyBarrett)),
+		("bits", ctypes.c_uint64),
+		("size", ctypes.c_uint64),
+		("c_size", ctypes.c_uint64),
+		("is_pooled", ctypes.c_uint8),
+	]
+	_anonymous_ = ()
+
+	def __init__(self, **kwargs):
+		for field_name, _ in self._fields_:
+			setattr(self, field_name, 0)
+		for key, value in kwargs.items():
+			if key in [f[0] for f in self._fields_]:
+				setattr(self, key, value)
+			else:
+				raise TypeError(f"Unknown field: {key}")
+		pass
+
+	def __repr__(self):
+		fields = "\n".join(
+			f"\t{name}: {getattr(self, name)!r}" for name, _ in self._fields_
+		)
+		return f"{self.__class__.__name__}: {{\n{fields}\n}}"
+
+	def __sizeof__():
+		return ctypes.sizeof(ChonkyMersenne)
+
+	def to_bytes(self):
+		return bytes(ctypes.string_at(ctypes.addressof(self), ctypes.sizeof(self)))
+
+	def hex_dump(self, sep=" "):
+		return sep.join(f"{b:02X}" for b in self.to_bytes())
+
+
+
+class ChonkyFixedBase(ctypes.Structure):
+	_fields_ = [
+		("mont", ctypes.POINTER(ChonkyMontgomery)),
+		("barrett", ctypes.POINTER(ChonkyBarrett)),
+		("table", ctypes.POINTER(ctypes.c_uint64)),
+		("size", ctypes.c_uint64),
+		("max_exp_bits", ctypes.c_uint64),
+		("window", ctypes.c_uint64),
+		("tables", ctypes.c_uint64),
+		("stride", ctypes.c_uint64),
+		("sub_stride", ctypes.c_uint64),
+		("is_pooled", ctypes.c_uint8),
+	]
+	_anonymous_ = ()
+
+	def __init__(self, **kwargs):
+		for field_name, _ in self._fields_:
+			setattr(self, field_name, 0)
+		for key, value in kwargs.items():
+			if key in [f[0] for f in self._fields_]:
+				setattr(self, key, value)
+			else:
+				raise TypeError(f"Unknown field: {key}")
+		pass
+
+	def __repr__(self):
+		fields = "\n".join(
+			f"\t{name}: {getattr(self, name)!r}" for name, _ in self._fields_
+		)
+		return f"{self.__class__.__name__}: {{\n{fields}\n}}"
+
+	def __sizeof__():
+		return ctypes.sizeof(ChonkyFixedBase)
+
+	def to_bytes(self):
+		return bytes(ctypes.string_at(ctypes.addressof(self), ctypes.sizeof(self)))
+
+	def hex_dump(self, sep=" "):
+		return sep.join(f"{b:02X}" for b in self.to_bytes())
+
+
+
+class ChonkyCrt(ctypes.Structure):
+	_fields_ = [
+		("mont_p", ctypes.POINTER(ChonkyMontgomery)),
+		("mont_q", ctypes.POINTER(ChonkyMontgomery)),
+		("dp", ctypes.POINTER(BigNum)),
+		("dq", ctypes.POINTER(BigNum)),
+		("qinv_r", ctypes.POINTER(BigNum)),
+		("is_pooled", ctypes.c_uint8),
+	]
+	_anonymous_ = ()
+
+	def __init__(self, **kwargs):
+		for field_name, _ in self._fields_:
+			setattr(self, field_name, 0)
+		for key, value in kwargs.items():
+			if key in [f[0] for f in self._fields_]:
+				setattr(self, key, value)
+			else:
+				raise TypeError(f"Unknown field: {key}")
+		pass
+
+	def __repr__(self):
+		fields = "\n".join(
+			f"\t{name}: {getattr(self, name)!r}" for name, _ in self._fields_
+		)
+		return f"{self.__class__.__name__}: {{\n{fields}\n}}"
+
+	def __sizeof__():
+		return ctypes.sizeof(ChonkyCrt)
+
+	def to_bytes(self):
+		return bytes(ctypes.string_at(ctypes.addressof(self), ctypes.sizeof(self)))
+
+	def hex_dump(self, sep=" "):
+		return sep.join(f"{b:02X}" for b in self.to_bytes())
+
+
 class ChonkyNums(Chonky_nums):
 	def __init__(self):
 		super().__init__()
 		pass
 
+	def alloc_chonky_pool(self, chunk_size):
+		alloc_chonky_pool = self.chonky_nums.alloc_chonky_pool
+		alloc_chonky_pool.argtypes = [ ctypes.c_uint64 ]
+		alloc_chonky_pool.restype = ctypes.POINTER(ChonkyPool)
+		return alloc_chonky_pool(chunk_size)
+
+	def dealloc_chonky_pool(self, pool):
+		dealloc_chonky_pool = self.chonky_nums.dealloc_chonky_pool
+		dealloc_chonky_pool.argtypes = [ ctypes.POINTER(ChonkyPool) ]
+		dealloc_chonky_pool.restype = None
+		return dealloc_chonky_pool(pool)
+
+	def chonky_pool_use(self, pool):
+		chonky_pool_use = self.chonky_nums.chonky_pool_use
+		chonky_pool_use.argtypes = [ ctypes.POINTER(ChonkyPool) ]
+		chonky_pool_use.restype = ctypes.POINTER(ChonkyPool)
+		return chonky_pool_use(pool)
+
+	def chonky_pool_mark(self, pool):
+		chonky_pool_mark = self.chonky_nums.chonky_pool_mark
+		chonky_pool_mark.argtypes = [ ctypes.POINTER(ChonkyPool) ]
+		chonky_pool_mark.restype = ctypes.c_int64
+		return chonky_pool_mark(pool)
+
+	def chonky_pool_reset(self, pool, mark_idx):
+		chonky_pool_reset = self.chonky_nums.chonky_pool_reset
+		chonky_pool_reset.argtypes = [ ctypes.POINTER(ChonkyPool), ctypes.c_int64 ]
+		chonky_pool_reset.restype = None
+		return chonky_pool_reset(pool, mark_idx)
+
+	def chonky_set_workers(self, count):
+		chonky_set_workers = self.chonky_nums.chonky_set_workers
+		chonky_set_workers.argtypes = [ ctypes.c_uint64 ]
+		chonky_set_workers.restype = ctypes.c_uint64
+		return chonky_set_workers(count)
+
 	def alloc_chonky_num(self, data, size, sign):
 		alloc_chonky_num = self.chonky_nums.alloc_chonky_num
 		alloc_chonky_num.argtypes = [ ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint64, ctypes.c_bool ]
@@ -69,23 +341,41 @@ class ChonkyNums(Chonky_nums):
 		alloc_chonky_num_from_data.restype = ctypes.POINTER(BigNum)
 		return alloc_chonky_num_from_data(data, size, sign, is_freeable)
 
+	def dup_chonky_num(self, num):
+		dup_chonky_num = self.chonky_nums.dup_chonky_num
+		dup_chonky_num.argtypes = [ ctypes.POINTER(BigNum) ]
+		dup_chonky_num.restype = ctypes.POINTER(BigNum)
+		return dup_chonky_num(num)
+
 	def dealloc_chonky_num(self, num):
 		dealloc_chonky_num = self.chonky_nums.dealloc_chonky_num
 		dealloc_chonky_num.argtypes = [ ctypes.POINTER(BigNum) ]
 		dealloc_chonky_num.restype = None
 		return dealloc_chonky_num(num)
 
+	def alloc_chonky_num_from_hex_string(self, data_str):
+		alloc_chonky_num_from_hex_string = self.chonky_nums.alloc_chonky_num_from_hex_string
+		alloc_chonky_num_from_hex_string.argtypes = [ ctypes.c_char_p ]
+		alloc_chonky_num_from_hex_string.restype = ctypes.POINTER(BigNum)
+		return alloc_chonky_num_from_hex_string(data_str)
+
 	def alloc_chonky_num_from_string(self, data_str):
 		alloc_chonky_num_from_string = self.chonky_nums.alloc_chonky_num_from_string
 		alloc_chonky_num_from_string.argtypes = [ ctypes.c_char_p ]
 		alloc_chonky_num_from_string.restype = ctypes.POINTER(BigNum)
 		return alloc_chonky_num_from_string(data_str)
 
-	def alloc_chonky_num_from_hex_string(self, data_str):
-		alloc_chonky_num_from_hex_string = self.chonky_nums.alloc_chonky_num_from_hex_string
-		alloc_chonky_num_from_hex_string.argtypes = [ ctypes.c_char_p ]
-		alloc_chonky_num_from_hex_string.restype = ctypes.POINTER(BigNum)
-		return alloc_chonky_num_from_hex_string(data_str)
+	def chonky_dec_string_size(self, num):
+		chonky_dec_string_size = self.chonky_nums.chonky_dec_string_size
+		chonky_dec_string_size.argtypes = [ ctypes.POINTER(BigNum) ]
+		chonky_dec_string_size.restype = ctypes.c_uint64
+		return chonky_dec_string_size(num)
+
+	def chonky_to_dec_string(self, num, buf, buf_size):
+		chonky_to_dec_string = self.chonky_nums.chonky_to_dec_string
+		chonky_to_dec_string.argtypes = [ ctypes.POINTER(BigNum), ctypes.c_char_p, ctypes.c_uint64 ]
+		chonky_to_dec_string.restype = ctypes.c_uint64
+		return chonky_to_dec_string(num, buf, buf_size)
 
 	def print_chonky_num(self, name, num, use_hex):
 		print_chonky_num = self.chonky_nums.print_chonky_num
@@ -93,57 +383,477 @@ class ChonkyNums(Chonky_nums):
 		print_chonky_num.restype = None
 		return print_chonky_num(name, num, use_hex)
 
+	def dealloc_chonky_montgomery(self, ctx):
+		dealloc_chonky_montgomery = self.chonky_nums.dealloc_chonky_montgomery
+		dealloc_chonky_montgomery.argtypes = [ ctypes.POINTER(ChonkyMontgomery) ]
+		dealloc_chonky_montgomery.restype = None
+		return dealloc_chonky_montgomery(ctx)
+
+	def alloc_chonky_montgomery(self, mod):
+		alloc_chonky_montgomery = self.chonky_nums.alloc_chonky_montgomery
+		alloc_chonky_montgomery.argtypes = [ ctypes.POINTER(BigNum) ]
+		alloc_chonky_montgomery.restype = ctypes.POINTER(ChonkyMontgomery)
+		return alloc_chonky_montgomery(mod)
+
+	def dealloc_chonky_barrett(self, ctx):
+		dealloc_chonky_barrett = self.chonky_nums.dealloc_chonky_barrett
+		dealloc_chonky_barrett.argtypes = [ ctypes.POINTER(ChonkyBarrett) ]
+		dealloc_chonky_barrett.restype = None
+		return dealloc_chonky_barrett(ctx)
+
+	def alloc_chonky_barrett(self, mod):
+		alloc_chonky_barrett = self.chonky_nums.alloc_chonky_barrett
+		alloc_chonky_barrett.argtypes = [ ctypes.POINTER(BigNum) ]
+		alloc_chonky_barrett.restype = ctypes.POINTER(ChonkyBarrett)
+		return alloc_chonky_barrett(mod)
+
+	def dealloc_chonky_mersenne(self, ctx):
+		dealloc_chonky_mersenne = self.chonky_nums.dealloc_chonky_mersenne
+		dealloc_chonky_mersenne.argtypes = [ ctypes.POINTER(ChonkyMersenne) ]
+		dealloc_chonky_mersenne.restype = None
+		return dealloc_chonky_mersenne(ctx)
+
+	def alloc_chonky_mersenne(self, mod):
+		alloc_chonky_mersenne = self.chonky_nums.alloc_chonky_mersenne
+		alloc_chonky_mersenne.argtypes = [ ctypes.POINTER(BigNum) ]
+		alloc_chonky_mersenne.restype = ctypes.POINTER(ChonkyMersenne)
+		return alloc_chonky_mersenne(mod)
+
+	def dealloc_chonky_fixed_base(self, ctx):
+		dealloc_chonky_fixed_base = self.chonky_nums.dealloc_chonky_fixed_base
+		dealloc_chonky_fixed_base.argtypes = [ ctypes.POINTER(ChonkyFixedBase) ]
+		dealloc_chonky_fixed_base.restype = None
+		return dealloc_chonky_fixed_base(ctx)
+
+	def alloc_chonky_fixed_base(self, base, mod, max_exp_bits, window, tables):
+		alloc_chonky_fixed_base = self.chonky_nums.alloc_chonky_fixed_base
+		alloc_chonky_fixed_base.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.c_uint64, ctypes.c_uint64, ctypes.c_uint64 ]
+		alloc_chonky_fixed_base.restype = ctypes.POINTER(ChonkyFixedBase)
+		return alloc_chonky_fixed_base(base, mod, max_exp_bits, window, tables)
+
+	def dealloc_chonky_crt(self, ctx):
+		dealloc_chonky_crt = self.chonky_nums.dealloc_chonky_crt
+		dealloc_chonky_crt.argtypes = [ ctypes.POINTER(ChonkyCrt) ]
+		dealloc_chonky_crt.restype = None
+		return dealloc_chonky_crt(ctx)
+
+	def alloc_chonky_crt(self, p, q, dp, dq, qinv):
+		alloc_chonky_crt = self.chonky_nums.alloc_chonky_crt
+		alloc_chonky_crt.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		alloc_chonky_crt.restype = ctypes.POINTER(ChonkyCrt)
+		return alloc_chonky_crt(p, q, dp, dq, qinv)
+
+	def alloc_chonky_crt_from_exp(self, p, q, d):
+		alloc_chonky_crt_from_exp = self.chonky_nums.alloc_chonky_crt_from_exp
+		alloc_chonky_crt_from_exp.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		alloc_chonky_crt_from_exp.restype = ctypes.POINTER(ChonkyCrt)
+		return alloc_chonky_crt_from_exp(p, q, d)
+
+	def chonky_add_into(self, res, a, b):
+		chonky_add_into = self.chonky_nums.chonky_add_into
+		chonky_add_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_add_into.restype = ctypes.POINTER(BigNum)
+		return chonky_add_into(res, a, b)
+
 	def chonky_add(self, a, b):
 		chonky_add = self.chonky_nums.chonky_add
 		chonky_add.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_add.restype = ctypes.POINTER(BigNum)
 		return chonky_add(a, b)
 
+	def chonky_sub_into(self, res, a, b):
+		chonky_sub_into = self.chonky_nums.chonky_sub_into
+		chonky_sub_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_sub_into.restype = ctypes.POINTER(BigNum)
+		return chonky_sub_into(res, a, b)
+
 	def chonky_sub(self, a, b):
 		chonky_sub = self.chonky_nums.chonky_sub
 		chonky_sub.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_sub.restype = ctypes.POINTER(BigNum)
 		return chonky_sub(a, b)
 
+	def chonky_mul_into(self, res, a, b):
+		chonky_mul_into = self.chonky_nums.chonky_mul_into
+		chonky_mul_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_mul_into.restype = ctypes.POINTER(BigNum)
+		return chonky_mul_into(res, a, b)
+
 	def chonky_mul(self, a, b):
 		chonky_mul = self.chonky_nums.chonky_mul
 		chonky_mul.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_mul.restype = ctypes.POINTER(BigNum)
 		return chonky_mul(a, b)
 
+	def chonky_sqr_into(self, res, num):
+		chonky_sqr_into = self.chonky_nums.chonky_sqr_into
+		chonky_sqr_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_sqr_into.restype = ctypes.POINTER(BigNum)
+		return chonky_sqr_into(res, num)
+
+	def chonky_sqr(self, num):
+		chonky_sqr = self.chonky_nums.chonky_sqr
+		chonky_sqr.argtypes = [ ctypes.POINTER(BigNum) ]
+		chonky_sqr.restype = ctypes.POINTER(BigNum)
+		return chonky_sqr(num)
+
+	def chonky_divmod_into(self, quotient, remainder, a, b):
+		chonky_divmod_into = self.chonky_nums.chonky_divmod_into
+		chonky_divmod_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_divmod_into.restype = ctypes.POINTER(BigNum)
+		return chonky_divmod_into(quotient, remainder, a, b)
+
+	def chonky_div_into(self, res, a, b):
+		chonky_div_into = self.chonky_nums.chonky_div_into
+		chonky_div_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_div_into.restype = ctypes.POINTER(BigNum)
+		return chonky_div_into(res, a, b)
+
 	def chonky_div(self, a, b):
 		chonky_div = self.chonky_nums.chonky_div
 		chonky_div.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_div.restype = ctypes.POINTER(BigNum)
 		return chonky_div(a, b)
 
+	def chonky_divmod(self, a, b, remainder):
+		chonky_divmod = self.chonky_nums.chonky_divmod
+		chonky_divmod.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ctypes.POINTER(BigNum)) ]
+		chonky_divmod.restype = ctypes.POINTER(BigNum)
+		return chonky_divmod(a, b, remainder)
+
+	def chonky_pow_into(self, res, num, exp):
+		chonky_pow_into = self.chonky_nums.chonky_pow_into
+		chonky_pow_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_pow_into.restype = ctypes.POINTER(BigNum)
+		return chonky_pow_into(res, num, exp)
+
 	def chonky_pow(self, num, exp):
 		chonky_pow = self.chonky_nums.chonky_pow
 		chonky_pow.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_pow.restype = ctypes.POINTER(BigNum)
 		return chonky_pow(num, exp)
 
+	def chonky_mod_into(self, res, num, mod):
+		chonky_mod_into = self.chonky_nums.chonky_mod_into
+		chonky_mod_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_mod_into.restype = ctypes.POINTER(BigNum)
+		return chonky_mod_into(res, num, mod)
+
 	def chonky_mod(self, num, mod):
 		chonky_mod = self.chonky_nums.chonky_mod
 		chonky_mod.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_mod.restype = ctypes.POINTER(BigNum)
 		return chonky_mod(num, mod)
 
+	def chonky_mersenne_reduce_into(self, res, num, ctx):
+		chonky_mersenne_reduce_into = self.chonky_nums.chonky_mersenne_reduce_into
+		chonky_mersenne_reduce_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyMersenne) ]
+		chonky_mersenne_reduce_into.restype = ctypes.POINTER(BigNum)
+		return chonky_mersenne_reduce_into(res, num, ctx)
+
+	def chonky_mersenne_reduce(self, num, ctx):
+		chonky_mersenne_reduce = self.chonky_nums.chonky_mersenne_reduce
+		chonky_mersenne_reduce.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyMersenne) ]
+		chonky_mersenne_reduce.restype = ctypes.POINTER(BigNum)
+		return chonky_mersenne_reduce(num, ctx)
+
+	def chonky_mersenne_mul_mod_into(self, res, a, b, ctx):
+		chonky_mersenne_mul_mod_into = self.chonky_nums.chonky_mersenne_mul_mod_into
+		chonky_mersenne_mul_mod_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyMersenne) ]
+		chonky_mersenne_mul_mod_into.restype = ctypes.POINTER(BigNum)
+		return chonky_mersenne_mul_mod_into(res, a, b, ctx)
+
+	def chonky_mersenne_mul_mod(self, a, b, ctx):
+		chonky_mersenne_mul_mod = self.chonky_nums.chonky_mersenne_mul_mod
+		chonky_mersenne_mul_mod.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyMersenne) ]
+		chonky_mersenne_mul_mod.restype = ctypes.POINTER(BigNum)
+		return chonky_mersenne_mul_mod(a, b, ctx)
+
+	def chonky_mod_mersenne_into(self, res, num, mod):
+		chonky_mod_mersenne_into = self.chonky_nums.chonky_mod_mersenne_into
+		chonky_mod_mersenne_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_mod_mersenne_into.restype = ctypes.POINTER(BigNum)
+		return chonky_mod_mersenne_into(res, num, mod)
+
 	def chonky_mod_mersenne(self, num, mod):
 		chonky_mod_mersenne = self.chonky_nums.chonky_mod_mersenne
 		chonky_mod_mersenne.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_mod_mersenne.restype = ctypes.POINTER(BigNum)
 		return chonky_mod_mersenne(num, mod)
 
+	def chonky_pow_mod_into(self, res, num, exp, mod):
+		chonky_pow_mod_into = self.chonky_nums.chonky_pow_mod_into
+		chonky_pow_mod_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_pow_mod_into.restype = ctypes.POINTER(BigNum)
+		return chonky_pow_mod_into(res, num, exp, mod)
+
 	def chonky_pow_mod(self, num, exp, mod):
 		chonky_pow_mod = self.chonky_nums.chonky_pow_mod
 		chonky_pow_mod.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_pow_mod.restype = ctypes.POINTER(BigNum)
 		return chonky_pow_mod(num, exp, mod)
 
+	def chonky_barrett_reduce_into(self, res, num, ctx):
+		chonky_barrett_reduce_into = self.chonky_nums.chonky_barrett_reduce_into
+		chonky_barrett_reduce_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyBarrett) ]
+		chonky_barrett_reduce_into.restype = ctypes.POINTER(BigNum)
+		return chonky_barrett_reduce_into(res, num, ctx)
+
+	def chonky_barrett_reduce(self, num, ctx):
+		chonky_barrett_reduce = self.chonky_nums.chonky_barrett_reduce
+		chonky_barrett_reduce.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyBarrett) ]
+		chonky_barrett_reduce.restype = ctypes.POINTER(BigNum)
+		return chonky_barrett_reduce(num, ctx)
+
+	def chonky_barrett_mul_mod_into(self, res, a, b, ctx):
+		chonky_barrett_mul_mod_into = self.chonky_nums.chonky_barrett_mul_mod_into
+		chonky_barrett_mul_mod_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyBarrett) ]
+		chonky_barrett_mul_mod_into.restype = ctypes.POINTER(BigNum)
+		return chonky_barrett_mul_mod_into(res, a, b, ctx)
+
+	def chonky_barrett_mul_mod(self, a, b, ctx):
+		chonky_barrett_mul_mod = self.chonky_nums.chonky_barrett_mul_mod
+		chonky_barrett_mul_mod.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyBarrett) ]
+		chonky_barrett_mul_mod.restype = ctypes.POINTER(BigNum)
+		return chonky_barrett_mul_mod(a, b, ctx)
+
+	def chonky_pow_mod_montgomery_into(self, res, num, exp, ctx):
+		chonky_pow_mod_montgomery_into = self.chonky_nums.chonky_pow_mod_montgomery_into
+		chonky_pow_mod_montgomery_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyMontgomery) ]
+		chonky_pow_mod_montgomery_into.restype = ctypes.POINTER(BigNum)
+		return chonky_pow_mod_montgomery_into(res, num, exp, ctx)
+
+	def chonky_pow_mod_montgomery(self, num, exp, ctx):
+		chonky_pow_mod_montgomery = self.chonky_nums.chonky_pow_mod_montgomery
+		chonky_pow_mod_montgomery.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyMontgomery) ]
+		chonky_pow_mod_montgomery.restype = ctypes.POINTER(BigNum)
+		return chonky_pow_mod_montgomery(num, exp, ctx)
+
+	def chonky_fixed_base_pow_mod_into(self, res, exp, ctx):
+		chonky_fixed_base_pow_mod_into = self.chonky_nums.chonky_fixed_base_pow_mod_into
+		chonky_fixed_base_pow_mod_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyFixedBase) ]
+		chonky_fixed_base_pow_mod_into.restype = ctypes.POINTER(BigNum)
+		return chonky_fixed_base_pow_mod_into(res, exp, ctx)
+
+	def chonky_fixed_base_pow_mod(self, exp, ctx):
+		chonky_fixed_base_pow_mod = self.chonky_nums.chonky_fixed_base_pow_mod
+		chonky_fixed_base_pow_mod.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyFixedBase) ]
+		chonky_fixed_base_pow_mod.restype = ctypes.POINTER(BigNum)
+		return chonky_fixed_base_pow_mod(exp, ctx)
+
+	def chonky_pow_mod_crt_into(self, res, num, ctx):
+		chonky_pow_mod_crt_into = self.chonky_nums.chonky_pow_mod_crt_into
+		chonky_pow_mod_crt_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyCrt) ]
+		chonky_pow_mod_crt_into.restype = ctypes.POINTER(BigNum)
+		return chonky_pow_mod_crt_into(res, num, ctx)
+
+	def chonky_pow_mod_crt(self, num, ctx):
+		chonky_pow_mod_crt = self.chonky_nums.chonky_pow_mod_crt
+		chonky_pow_mod_crt.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(ChonkyCrt) ]
+		chonky_pow_mod_crt.restype = ctypes.POINTER(BigNum)
+		return chonky_pow_mod_crt(num, ctx)
+
+	def chonky_multi_pow_mod_into(self, res, nums, exps, count, mod):
+		chonky_multi_pow_mod_into = self.chonky_nums.chonky_multi_pow_mod_into
+		chonky_multi_pow_mod_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.c_uint64, ctypes.POINTER(BigNum) ]
+		chonky_multi_pow_mod_into.restype = ctypes.POINTER(BigNum)
+		return chonky_multi_pow_mod_into(res, nums, exps, count, mod)
+
+	def chonky_multi_pow_mod(self, nums, exps, count, mod):
+		chonky_multi_pow_mod = self.chonky_nums.chonky_multi_pow_mod
+		chonky_multi_pow_mod.argtypes = [ ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.c_uint64, ctypes.POINTER(BigNum) ]
+		chonky_multi_pow_mod.restype = ctypes.POINTER(BigNum)
+		return chonky_multi_pow_mod(nums, exps, count, mod)
+
+	def chonky_is_probable_prime(self, num, rounds):
+		chonky_is_probable_prime = self.chonky_nums.chonky_is_probable_prime
+		chonky_is_probable_prime.argtypes = [ ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_is_probable_prime.restype = ctypes.c_bool
+		return chonky_is_probable_prime(num, rounds)
+
+	def chonky_miller_rabin(self, num, rounds):
+		chonky_miller_rabin = self.chonky_nums.chonky_miller_rabin
+		chonky_miller_rabin.argtypes = [ ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_miller_rabin.restype = ctypes.c_bool
+		return chonky_miller_rabin(num, rounds)
+
+	def chonky_gen_prime_into(self, res, bits, rounds):
+		chonky_gen_prime_into = self.chonky_nums.chonky_gen_prime_into
+		chonky_gen_prime_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.c_uint64, ctypes.c_uint64 ]
+		chonky_gen_prime_into.restype = ctypes.POINTER(BigNum)
+		return chonky_gen_prime_into(res, bits, rounds)
+
+	def chonky_gen_prime(self, bits, rounds):
+		chonky_gen_prime = self.chonky_nums.chonky_gen_prime
+		chonky_gen_prime.argtypes = [ ctypes.c_uint64, ctypes.c_uint64 ]
+		chonky_gen_prime.restype = ctypes.POINTER(BigNum)
+		return chonky_gen_prime(bits, rounds)
+
+	def chonky_pow_mod_mersenne_into(self, res, num, exp, mod):
+		chonky_pow_mod_mersenne_into = self.chonky_nums.chonky_pow_mod_mersenne_into
+		chonky_pow_mod_mersenne_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_pow_mod_mersenne_into.restype = ctypes.POINTER(BigNum)
+		return chonky_pow_mod_mersenne_into(res, num, exp, mod)
+
 	def chonky_pow_mod_mersenne(self, num, exp, mod):
 		chonky_pow_mod_mersenne = self.chonky_nums.chonky_pow_mod_mersenne
 		chonky_pow_mod_mersenne.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
 		chonky_pow_mod_mersenne.restype = ctypes.POINTER(BigNum)
 		return chonky_pow_mod_mersenne(num, exp, mod)
 
+	def chonky_shl_into(self, res, num, bit_cnt):
+		chonky_shl_into = self.chonky_nums.chonky_shl_into
+		chonky_shl_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_shl_into.restype = ctypes.POINTER(BigNum)
+		return chonky_shl_into(res, num, bit_cnt)
+
+	def chonky_shl(self, num, bit_cnt):
+		chonky_shl = self.chonky_nums.chonky_shl
+		chonky_shl.argtypes = [ ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_shl.restype = ctypes.POINTER(BigNum)
+		return chonky_shl(num, bit_cnt)
+
+	def chonky_shr_into(self, res, num, bit_cnt):
+		chonky_shr_into = self.chonky_nums.chonky_shr_into
+		chonky_shr_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_shr_into.restype = ctypes.POINTER(BigNum)
+		return chonky_shr_into(res, num, bit_cnt)
+
+	def chonky_shr(self, num, bit_cnt):
+		chonky_shr = self.chonky_nums.chonky_shr
+		chonky_shr.argtypes = [ ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_shr.restype = ctypes.POINTER(BigNum)
+		return chonky_shr(num, bit_cnt)
+
+	def chonky_mask_into(self, res, num, bit_cnt):
+		chonky_mask_into = self.chonky_nums.chonky_mask_into
+		chonky_mask_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_mask_into.restype = ctypes.POINTER(BigNum)
+		return chonky_mask_into(res, num, bit_cnt)
+
+	def chonky_mask(self, num, bit_cnt):
+		chonky_mask = self.chonky_nums.chonky_mask
+		chonky_mask.argtypes = [ ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_mask.restype = ctypes.POINTER(BigNum)
+		return chonky_mask(num, bit_cnt)
+
+	def chonky_not_into(self, res, num, bit_cnt):
+		chonky_not_into = self.chonky_nums.chonky_not_into
+		chonky_not_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_not_into.restype = ctypes.POINTER(BigNum)
+		return chonky_not_into(res, num, bit_cnt)
+
+	def chonky_not(self, num, bit_cnt):
+		chonky_not = self.chonky_nums.chonky_not
+		chonky_not.argtypes = [ ctypes.POINTER(BigNum), ctypes.c_uint64 ]
+		chonky_not.restype = ctypes.POINTER(BigNum)
+		return chonky_not(num, bit_cnt)
+
+	def chonky_and_into(self, res, a, b):
+		chonky_and_into = self.chonky_nums.chonky_and_into
+		chonky_and_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_and_into.restype = ctypes.POINTER(BigNum)
+		return chonky_and_into(res, a, b)
+
+	def chonky_and(self, a, b):
+		chonky_and = self.chonky_nums.chonky_and
+		chonky_and.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_and.restype = ctypes.POINTER(BigNum)
+		return chonky_and(a, b)
+
+	def chonky_or_into(self, res, a, b):
+		chonky_or_into = self.chonky_nums.chonky_or_into
+		chonky_or_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_or_into.restype = ctypes.POINTER(BigNum)
+		return chonky_or_into(res, a, b)
+
+	def chonky_or(self, a, b):
+		chonky_or = self.chonky_nums.chonky_or
+		chonky_or.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_or.restype = ctypes.POINTER(BigNum)
+		return chonky_or(a, b)
+
+	def chonky_xor_into(self, res, a, b):
+		chonky_xor_into = self.chonky_nums.chonky_xor_into
+		chonky_xor_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_xor_into.restype = ctypes.POINTER(BigNum)
+		return chonky_xor_into(res, a, b)
+
+	def chonky_xor(self, a, b):
+		chonky_xor = self.chonky_nums.chonky_xor
+		chonky_xor.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_xor.restype = ctypes.POINTER(BigNum)
+		return chonky_xor(a, b)
+
+	def chonky_popcount(self, num):
+		chonky_popcount = self.chonky_nums.chonky_popcount
+		chonky_popcount.argtypes = [ ctypes.POINTER(BigNum) ]
+		chonky_popcount.restype = ctypes.c_uint64
+		return chonky_popcount(num)
+
+	def chonky_lowest_bit(self, num):
+		chonky_lowest_bit = self.chonky_nums.chonky_lowest_bit
+		chonky_lowest_bit.argtypes = [ ctypes.POINTER(BigNum) ]
+		chonky_lowest_bit.restype = ctypes.c_int64
+		return chonky_lowest_bit(num)
+
+	def chonky_highest_bit(self, num):
+		chonky_highest_bit = self.chonky_nums.chonky_highest_bit
+		chonky_highest_bit.argtypes = [ ctypes.POINTER(BigNum) ]
+		chonky_highest_bit.restype = ctypes.c_int64
+		return chonky_highest_bit(num)
+
+	def chonky_gcd_into(self, res, a, b):
+		chonky_gcd_into = self.chonky_nums.chonky_gcd_into
+		chonky_gcd_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_gcd_into.restype = ctypes.POINTER(BigNum)
+		return chonky_gcd_into(res, a, b)
+
+	def chonky_gcd(self, a, b):
+		chonky_gcd = self.chonky_nums.chonky_gcd
+		chonky_gcd.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_gcd.restype = ctypes.POINTER(BigNum)
+		return chonky_gcd(a, b)
+
+	def chonky_gcd_ext_into(self, g, x, y, a, b):
+		chonky_gcd_ext_into = self.chonky_nums.chonky_gcd_ext_into
+		chonky_gcd_ext_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_gcd_ext_into.restype = ctypes.POINTER(BigNum)
+		return chonky_gcd_ext_into(g, x, y, a, b)
+
+	def chonky_gcd_ext(self, a, b, x, y):
+		chonky_gcd_ext = self.chonky_nums.chonky_gcd_ext
+		chonky_gcd_ext.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)) ]
+		chonky_gcd_ext.restype = ctypes.POINTER(BigNum)
+		return chonky_gcd_ext(a, b, x, y)
+
+	def chonky_invert_into(self, res, num, mod):
+		chonky_invert_into = self.chonky_nums.chonky_invert_into
+		chonky_invert_into.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_invert_into.restype = ctypes.POINTER(BigNum)
+		return chonky_invert_into(res, num, mod)
+
+	def chonky_invert(self, num, mod):
+		chonky_invert = self.chonky_nums.chonky_invert
+		chonky_invert.argtypes = [ ctypes.POINTER(BigNum), ctypes.POINTER(BigNum) ]
+		chonky_invert.restype = ctypes.POINTER(BigNum)
+		return chonky_invert(num, mod)
+
+	def chonky_add_batch(self, res, a, b, count):
+		chonky_add_batch = self.chonky_nums.chonky_add_batch
+		chonky_add_batch.argtypes = [ ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.c_uint64 ]
+		chonky_add_batch.restype = ctypes.POINTER(ctypes.POINTER(BigNum))
+		return chonky_add_batch(res, a, b, count)
+
+	def chonky_mul_batch(self, res, a, b, count):
+		chonky_mul_batch = self.chonky_nums.chonky_mul_batch
+		chonky_mul_batch.argtypes = [ ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.c_uint64 ]
+		chonky_mul_batch.restype = ctypes.POINTER(ctypes.POINTER(BigNum))
+		return chonky_mul_batch(res, a, b, count)
+
+	def chonky_pow_mod_batch(self, res, num, exp, mod, count):
+		chonky_pow_mod_batch = self.chonky_nums.chonky_pow_mod_batch
+		chonky_pow_mod_batch.argtypes = [ ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.POINTER(ctypes.POINTER(BigNum)), ctypes.c_uint64 ]
+		chonky_pow_mod_batch.restype = ctypes.POINTER(ctypes.POINTER(BigNum))
+		return chonky_pow_mod_batch(res, num, exp, mod, count)
+
@@ -20,6 +20,82 @@ def int_to_bytes(x, n=64):
 def bytes_to_int(b):
     return int.from_bytes(b, "little")
 
+def size_of(x):
+    return 8 * ((abs(x).bit_length() + 63) // 64 + 1)
+
+def to_big(chonky_nums, x, size = None):
+    if size is None: size = size_of(x)
+    x_bytes = int_to_bytes(abs(x), size)
+    return chonky_nums.alloc_chonky_num(ctypes.cast(x_bytes, ctypes.POINTER(ctypes.c_uint8)), size, int(x < 0))
+
+def to_int(big):
+    return bytes_to_int(ctypes.string_at(big.contents.data, big.contents.size)) * (1 - 2 * big.contents.sign)
+
+# Reference primality test, Miller-Rabin over the first thirteen prime bases,
+# which is deterministic below 3.3 * 10^24
+def is_probable_prime(n):
+    if n < 2: return False
+    for p in (2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37):
+        if n % p == 0: return n == p
+    d, s = n - 1, 0
+    while d % 2 == 0: d, s = d // 2, s + 1
+    for a in (2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41):
+        if a >= n: break
+        x = pow(a, d, n)
+        if x in (1, n - 1): continue
+        for _ in range(s - 1):
+            x = x * x % n
+            if x == n - 1: break
+        else:
+            return False
+    return True
+
+@timed
+def test_from_string(chonky_nums):   
+    if hasattr(sys, "set_int_max_str_digits"): sys.set_int_max_str_digits(0)
+    for i in range(300):
+        # Covers both the chunked basecase and the divide and conquer path
+        digits = random.choice([1, 18, 19, 20, 38, 200, 511, 512, 513, 4000, 30000])
+        a = random.randint(0, 10 ** digits - 1)
+        a_str = str(a).zfill(digits) if i % 3 == 0 else str(a)
+        a_sign = random.getrandbits(1)
+        
+        big_a = chonky_nums.alloc_chonky_num_from_string(("-" * a_sign + a_str).encode())
+        assert big_a, "Failed to parse"
+        
+        result = bytes_to_int(ctypes.string_at(big_a.contents.data, big_a.contents.size))
+        assert big_a.contents.sign == a_sign, "Sign mismatch"
+        chonky_nums.dealloc_chonky_num(big_a)
+
+        assert result == a, f"Mismatch:\nStr = {a_str}\nRes = {result}"
+    
+    assert not chonky_nums.alloc_chonky_num_from_string(b"12a4"), "Invalid digits must be rejected"
+    return
+
+@timed
+def test_to_dec_string(chonky_nums):   
+    if hasattr(sys, "set_int_max_str_digits"): sys.set_int_max_str_digits(0)
+    for i in range(300):
+        # Covers both the limb by limb basecase and the divide and conquer path
+        a = random.getrandbits(random.choice([1, 64, 65, 512, 1700, 1800, 8192, 100000]))
+        if i % 5 == 0: a = 10 ** len(str(a)) - 1
+        a_sign = random.getrandbits(1)
+        expected = str(-a if a_sign else a)
+        
+        a_size = 8 * ((a.bit_length() + 63) // 64 + 1)
+        a_bytes = int_to_bytes(a, a_size)
+        big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), a_size, a_sign)
+
+        # Both the upper bound and the exact size must be accepted
+        for buf_size in [chonky_nums.chonky_dec_string_size(big_a), len(expected) + 1]:
+            buf = ctypes.create_string_buffer(buf_size)
+            length = chonky_nums.chonky_to_dec_string(big_a, buf, buf_size)
+            assert length == len(expected) and buf.value.decode() == expected, f"Mismatch:\nRes = {buf.value.decode()}\nExp = {expected}"
+
+        chonky_nums.dealloc_chonky_num(big_a)
+    
+    return
+
 @timed
 def test_add(chonky_nums):   
     for _ in range(10000):
@@ -113,6 +189,132 @@ def test_mul(chonky_nums):
         assert result == expected, f"Mismatch:\nA = {a:x}\nB = {b:x}\nRes = {result:x}\nExp = {expected:x}"
     return
 
+@timed
+def test_workers(chonky_nums):   
+    assert chonky_nums.chonky_set_workers(4) == 4, "Failed to start the workers"
+    
+    # Half of the products run with a pool installed on the calling thread
+    pool = chonky_nums.alloc_chonky_pool(0)
+    for i in range(12):
+        if i == 6: chonky_nums.chonky_pool_use(pool)
+
+        a_size = random.randint(2048, 16384) * 8
+        b_size = random.randint(a_size // 16, a_size // 8) * 8
+        a = random.getrandbits(a_size * 8)
+        b = random.getrandbits(b_size * 8)
+        big_a, big_b = to_big(chonky_nums, a, a_size), to_big(chonky_nums, b, b_size)
+
+        res = chonky_nums.chonky_mul(big_a, big_b)
+        assert res, "Failed to multiply"
+        assert to_int(res) == a * b, f"Mismatch in the product of {a_size} and {b_size} bytes"
+        chonky_nums.dealloc_chonky_num(res)
+
+        res = chonky_nums.chonky_sqr(big_a)
+        assert res, "Failed to square"
+        assert to_int(res) == a * a, f"Mismatch in the square of {a_size} bytes"
+        chonky_nums.dealloc_chonky_num(res)
+
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_b)
+
+    chonky_nums.chonky_pool_use(None)
+    chonky_nums.dealloc_chonky_pool(pool)
+    
+    assert chonky_nums.chonky_set_workers(0) == 0, "Failed to stop the workers"
+
+    return
+
+@timed
+def test_ntt(chonky_nums):   
+    for i in range(16):
+        # The second half runs the three transforms on the workers
+        if i == 8: assert chonky_nums.chonky_set_workers(2) == 2, "Failed to start the workers"
+
+        a_size = random.randint(4096, 20000) * 8
+        b_size = random.choice([a_size, random.randint(4096, a_size // 8) * 8])
+        
+        # All ones limbs give the biggest coefficients
+        if i % 4 == 0: a, b = (1 << (a_size * 8)) - 1, (1 << (b_size * 8)) - 1
+        else: a, b = random.getrandbits(a_size * 8), random.getrandbits(b_size * 8)
+        big_a, big_b = to_big(chonky_nums, a, a_size), to_big(chonky_nums, b, b_size)
+
+        res = chonky_nums.chonky_mul(big_a, big_b)
+        assert res, "Failed to multiply"
+        assert to_int(res) == a * b, f"Mismatch in the product of {a_size} and {b_size} bytes"
+        chonky_nums.dealloc_chonky_num(res)
+
+        res = chonky_nums.chonky_sqr(big_a)
+        assert res, "Failed to square"
+        assert to_int(res) == a * a, f"Mismatch in the square of {a_size} bytes"
+        chonky_nums.dealloc_chonky_num(res)
+
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_b)
+    
+    chonky_nums.chonky_set_workers(0)
+
+    return
+
+@timed
+def test_mul_large(chonky_nums):   
+    for i in range(500):
+        a_size = random.randint(1, 2048) * 8
+        b_size = random.randint(1, 2048) * 8
+        a = random.getrandbits(a_size * 8)
+        b = random.getrandbits(b_size * 8)
+        expected = a * b
+        
+        a_bytes = int_to_bytes(a, a_size)
+        b_bytes = int_to_bytes(b, b_size)
+
+        big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), a_size, 0)
+        big_b = chonky_nums.alloc_chonky_num(ctypes.cast(b_bytes, ctypes.POINTER(ctypes.c_uint8)), b_size, 0)
+
+        res = chonky_nums.chonky_mul(big_a, big_b)
+        if not res:
+            chonky_nums.dealloc_chonky_num(big_a)
+            chonky_nums.dealloc_chonky_num(big_b)
+            continue
+        
+        result = bytes_to_int(ctypes.string_at(res.contents.data, res.contents.size))
+
+        # Fix Sign
+        result *= 1 - 2 * res.contents.sign
+        
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_b)
+        chonky_nums.dealloc_chonky_num(res)
+
+        assert result == expected, f"Mismatch:\nA = {a:x}\nB = {b:x}\nRes = {result:x}\nExp = {expected:x}"
+    return
+
+@timed
+def test_sqr(chonky_nums):   
+    for i in range(1000):
+        a_size = random.randint(1, 1024) * 8
+        a = random.getrandbits(a_size * 8)
+        expected = a * a
+        
+        a_bytes = int_to_bytes(a, a_size)
+
+        big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), a_size, 0)
+
+        res = chonky_nums.chonky_sqr(big_a)
+        if not res:
+            chonky_nums.dealloc_chonky_num(big_a)
+            continue
+        
+        result = bytes_to_int(ctypes.string_at(res.contents.data, res.contents.size))
+
+        # Fix Sign
+        result *= 1 - 2 * res.contents.sign
+        
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(res)
+
+        assert result == expected, f"Mismatch:\nA = {a:x}\nRes = {result:x}\nExp = {expected:x}"
+    return
+
 @timed
 def test_div(chonky_nums):   
     for i in range(10000):
@@ -146,6 +348,407 @@ def test_div(chonky_nums):
         assert result == expected, f"Mismatch:\nA = {a:x}\nB = {b:x}\nRes = {result:x}\nExp = {expected:x}"
     return
 
+@timed
+def test_divmod(chonky_nums):   
+    for i in range(2000):
+        a = random.getrandbits(random.randint(1, 4096))
+        b = random.getrandbits(random.randint(1, a.bit_length() + 128)) or 1
+        
+        # Limbs at the edges stress the quotient estimation and the add-back
+        if i % 4 == 0:
+            edges = [0, 1, (1 << 63), (1 << 64) - 1]
+            a = sum(random.choice(edges) << (64 * j) for j in range(random.randint(1, 16)))
+            b = sum(random.choice(edges) << (64 * j) for j in range(random.randint(1, 8))) or 1
+        
+        a_sign, b_sign = random.getrandbits(1), random.getrandbits(1)
+        
+        # Truncated division, the remainder takes the sign of the dividend
+        expected_q = (a // b) * (1 - 2 * (a_sign ^ b_sign))
+        expected_r = (a % b) * (1 - 2 * a_sign)
+
+        a_size = 8 * ((a.bit_length() + 63) // 64 + 1)
+        b_size = 8 * ((b.bit_length() + 63) // 64)
+        a_bytes = int_to_bytes(a, a_size)
+        b_bytes = int_to_bytes(b, b_size)
+
+        big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), a_size, a_sign)
+        big_b = chonky_nums.alloc_chonky_num(ctypes.cast(b_bytes, ctypes.POINTER(ctypes.c_uint8)), b_size, b_sign)
+        
+        rem = ctypes.POINTER(BigNum)()
+        quot = chonky_nums.chonky_divmod(big_a, big_b, ctypes.byref(rem))
+        assert quot and rem, "Failed to divide"
+        
+        result_q = bytes_to_int(ctypes.string_at(quot.contents.data, quot.contents.size)) * (1 - 2 * quot.contents.sign)
+        result_r = bytes_to_int(ctypes.string_at(rem.contents.data, rem.contents.size)) * (1 - 2 * rem.contents.sign)
+        
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_b)
+        chonky_nums.dealloc_chonky_num(quot)
+        chonky_nums.dealloc_chonky_num(rem)
+
+        assert result_q == expected_q, f"Mismatch:\nA = {a:x}\nB = {b:x}\nRes = {result_q:x}\nExp = {expected_q:x}"
+        assert result_r == expected_r, f"Mismatch:\nA = {a:x}\nB = {b:x}\nRes = {result_r:x}\nExp = {expected_r:x}"
+    return
+
+@timed
+def test_bitwise(chonky_nums):   
+    def sign_of(x):
+        return -1 if x < 0 else 1
+
+    shift_ops = [
+        ("chonky_shl_into", lambda a, k: sign_of(a) * (abs(a) << k)),
+        ("chonky_shr_into", lambda a, k: sign_of(a) * (abs(a) >> k)),
+        ("chonky_mask_into", lambda a, k: abs(a) & ((1 << k) - 1)),
+        ("chonky_not_into", lambda a, k: (abs(a) & ((1 << k) - 1)) ^ ((1 << k) - 1)),
+    ]
+    
+    bitwise_ops = [
+        ("chonky_and_into", lambda a, b: abs(a) & abs(b)),
+        ("chonky_or_into", lambda a, b: abs(a) | abs(b)),
+        ("chonky_xor_into", lambda a, b: abs(a) ^ abs(b)),
+    ]
+
+    # The same result is reused across every iteration, growing as needed
+    res = chonky_nums.alloc_chonky_num(None, 8, 0)
+    for i in range(500):
+        a = random.getrandbits(random.randint(0, 1024)) * random.choice([-1, 1])
+        b = random.getrandbits(random.randint(0, 1024)) * random.choice([-1, 1])
+        k = random.choice([0, 1, 63, 64, 65, random.randint(0, 1200)])
+        size = 8 * ((max(a.bit_length(), b.bit_length()) + 63) // 64 + 1)
+        
+        for name, op in shift_ops:
+            big_a = to_big(chonky_nums, a, size)
+            expected = op(a, k)
+            
+            assert getattr(chonky_nums, name)(res, big_a, k), f"{name} failed"
+            assert to_int(res) == expected, f"{name} mismatch:\nA = {a:x}\nK = {k}\nRes = {to_int(res):x}\nExp = {expected:x}"
+            assert chonky_nums.chonky_highest_bit(res) == abs(expected).bit_length() - 1, f"{name} used limbs mismatch"
+
+            # Aliasing the operand with the result
+            assert getattr(chonky_nums, name)(big_a, big_a, k), f"{name} failed"
+            assert to_int(big_a) == expected, f"{name} (res == a) mismatch:\nA = {a:x}\nK = {k}\nRes = {to_int(big_a):x}\nExp = {expected:x}"
+            chonky_nums.dealloc_chonky_num(big_a)
+        
+        for name, op in bitwise_ops:
+            big_a = to_big(chonky_nums, a, size)
+            big_b = to_big(chonky_nums, b, size)
+            expected = op(a, b)
+            
+            assert getattr(chonky_nums, name)(res, big_a, big_b), f"{name} failed"
+            assert to_int(res) == expected, f"{name} mismatch:\nA = {a:x}\nB = {b:x}\nRes = {to_int(res):x}\nExp = {expected:x}"
+            assert chonky_nums.chonky_highest_bit(res) == expected.bit_length() - 1, f"{name} used limbs mismatch"
+            
+            assert getattr(chonky_nums, name)(big_b, big_a, big_b), f"{name} failed"
+            assert to_int(big_b) == expected, f"{name} (res == b) mismatch:\nA = {a:x}\nB = {b:x}\nRes = {to_int(big_b):x}\nExp = {expected:x}"
+            chonky_nums.dealloc_chonky_num(big_a)
+            chonky_nums.dealloc_chonky_num(big_b)
+
+        big_a = to_big(chonky_nums, a, size)
+        lowest = (abs(a) & -abs(a)).bit_length() - 1
+        assert chonky_nums.chonky_popcount(big_a) == bin(abs(a)).count("1"), f"chonky_popcount mismatch:\nA = {a:x}"
+        assert chonky_nums.chonky_lowest_bit(big_a) == lowest, f"chonky_lowest_bit mismatch:\nA = {a:x}"
+        assert chonky_nums.chonky_highest_bit(big_a) == abs(a).bit_length() - 1, f"chonky_highest_bit mismatch:\nA = {a:x}"
+        
+        shifted = chonky_nums.chonky_shl(big_a, k)
+        assert shifted and to_int(shifted) == sign_of(a) * (abs(a) << k), f"chonky_shl mismatch:\nA = {a:x}\nK = {k}"
+        chonky_nums.dealloc_chonky_num(shifted)
+        chonky_nums.dealloc_chonky_num(big_a)
+
+    chonky_nums.dealloc_chonky_num(res)
+
+    return
+
+@timed
+def test_into(chonky_nums):   
+    def trunc_div(a, b):
+        q = abs(a) // abs(b)
+        return q if (a < 0) == (b < 0) else -q
+
+    ops = [
+        ("chonky_add_into", lambda a, b: a + b),
+        ("chonky_sub_into", lambda a, b: a - b),
+        ("chonky_mul_into", lambda a, b: a * b),
+        ("chonky_div_into", trunc_div),
+        ("chonky_mod_into", lambda a, b: abs(a) % abs(b)),
+    ]
+
+    # The same result is reused across every iteration, growing as needed
+    res = chonky_nums.alloc_chonky_num(None, 8, 0)
+    for i in range(500):
+        a = random.getrandbits(random.randint(1, 1024)) * random.choice([-1, 1])
+        b = (random.getrandbits(random.randint(1, 1024)) or 1) * random.choice([-1, 1])
+        size = 8 * ((max(a.bit_length(), b.bit_length()) + 63) // 64 + 1)
+        
+        for name, op in ops:
+            big_a = to_big(chonky_nums, a, size)
+            big_b = to_big(chonky_nums, b, size)
+            expected = op(a, b)
+            
+            assert getattr(chonky_nums, name)(res, big_a, big_b), f"{name} failed"
+            assert to_int(res) == expected, f"{name} mismatch:\nA = {a:x}\nB = {b:x}\nRes = {to_int(res):x}\nExp = {expected:x}"
+            
+            # Aliasing both operands with the result
+            assert getattr(chonky_nums, name)(big_a, big_a, big_b), f"{name} failed"
+            assert to_int(big_a) == expected, f"{name} (res == a) mismatch:\nA = {a:x}\nB = {b:x}\nRes = {to_int(big_a):x}\nExp = {expected:x}"
+            assert getattr(chonky_nums, name)(big_b, to_big(chonky_nums, a, size), big_b), f"{name} failed"
+            assert to_int(big_b) == expected, f"{name} (res == b) mismatch:\nA = {a:x}\nB = {b:x}\nRes = {to_int(big_b):x}\nExp = {expected:x}"
+            
+            chonky_nums.dealloc_chonky_num(big_a)
+            chonky_nums.dealloc_chonky_num(big_b)
+
+        # Modular exponentiation, with the result aliasing the modulus
+        m = abs(b) | 1 if i % 2 else abs(b) + (abs(b) == 1)
+        big_a = to_big(chonky_nums, abs(a), size)
+        big_e = to_big(chonky_nums, abs(b), size)
+        big_m = to_big(chonky_nums, m, size)
+        assert chonky_nums.chonky_pow_mod_into(big_m, big_a, big_e, big_m), "chonky_pow_mod_into failed"
+        assert to_int(big_m) == pow(abs(a), abs(b), m), f"chonky_pow_mod_into mismatch:\nA = {a:x}\nB = {b:x}\nM = {m:x}"
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_e)
+        chonky_nums.dealloc_chonky_num(big_m)
+
+    chonky_nums.dealloc_chonky_num(res)
+    
+    return
+
+@timed
+def test_limbs(chonky_nums):   
+    ops = [
+        ("chonky_add_into", lambda a, b: a + b),
+        ("chonky_sub_into", lambda a, b: a - b),
+        ("chonky_mul_into", lambda a, b: a * b),
+        ("chonky_div_into", lambda a, b: abs(a) // abs(b)),
+        ("chonky_mod_into", lambda a, b: abs(a) % abs(b)),
+    ]
+
+    # The used limbs must follow the value, also when the result shrinks
+    res = chonky_nums.alloc_chonky_num(None, 8, 0)
+    for _ in range(500):
+        a = random.getrandbits(random.randint(0, 1024)) * random.choice([-1, 1])
+        b = (random.getrandbits(random.randint(1, 1024)) or 1) * random.choice([-1, 1])
+        size = 8 * ((max(a.bit_length(), b.bit_length()) + 63) // 64 + 1)
+        big_a = to_big(chonky_nums, a, size)
+        big_b = to_big(chonky_nums, b, size)
+        
+        for name, op in ops:
+            expected = abs(op(a, b))
+            assert getattr(chonky_nums, name)(res, big_a, big_b), f"{name} failed"
+            assert abs(to_int(res)) == expected, f"{name} mismatch:\nA = {a:x}\nB = {b:x}"
+            assert res.contents.limbs == (expected.bit_length() + 63) // 64, f"{name} used limbs mismatch:\nA = {a:x}\nB = {b:x}\nLimbs = {res.contents.limbs}"
+        
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_b)
+
+    chonky_nums.dealloc_chonky_num(res)
+    
+    return
+
+@timed
+def test_inline(chonky_nums):   
+    def is_inline(big):
+        return ctypes.addressof(big.contents.data.contents) == ctypes.addressof(big.contents.inline_limbs)
+
+    inline_size = BigNum.inline_limbs.size
+    for _ in range(1000):
+        a = random.getrandbits(random.randint(1, 8 * inline_size))
+        b = random.getrandbits(random.randint(1, 1024)) or 1
+        res = to_big(chonky_nums, a, inline_size)
+        big_b = to_big(chonky_nums, b, 8 * ((b.bit_length() + 63) // 64))
+        assert is_inline(res), "Small numbers should not allocate their limbs"
+        
+        # Spills to the heap when growing
+        assert chonky_nums.chonky_mul_into(res, res, big_b), "chonky_mul_into failed"
+        assert to_int(res) == a * b, f"Inline mul mismatch:\nA = {a:x}\nB = {b:x}"
+        assert is_inline(res) == (res.contents.size <= inline_size), "The limbs are not where they should be"
+        
+        # And comes back once the result is shrunk
+        quot = chonky_nums.chonky_div(res, big_b)
+        assert to_int(quot) == a, f"Inline div mismatch:\nA = {a:x}\nB = {b:x}"
+        assert is_inline(quot), "Shrunk numbers should move back to the inline limbs"
+        
+        chonky_nums.dealloc_chonky_num(res)
+        chonky_nums.dealloc_chonky_num(big_b)
+        chonky_nums.dealloc_chonky_num(quot)
+    
+    return
+
+@timed
+def test_pool(chonky_nums):   
+    # A small chunk size, so that chunks get chained and rewound as well
+    pool = chonky_nums.alloc_chonky_pool(4096)
+    assert pool, "alloc_chonky_pool failed"
+    assert not chonky_nums.chonky_pool_use(pool), "A pool was already installed"
+    
+    # Kept across the resets, as it is allocated before the first mark, and
+    # big enough to never be moved by the additions
+    kept = to_big(chonky_nums, 0, 8 * (8192 // 64 + 2))
+    assert kept.contents.is_pooled, "The number was not allocated from the pool"
+
+    for i in range(50):
+        mark = chonky_nums.chonky_pool_mark(pool)
+        assert mark == 0, f"Unexpected mark {mark}"
+        
+        for _ in range(20):
+            a = random.getrandbits(random.randint(1, 8192))
+            b = random.getrandbits(random.randint(1, 8192)) or 1
+            size = 8 * ((max(a.bit_length(), b.bit_length()) + 63) // 64 + 1)
+            big_a = to_big(chonky_nums, a, size)
+            big_b = to_big(chonky_nums, b, size)
+            
+            # Nested marks, released on their own or along with the outer one
+            inner = chonky_nums.chonky_pool_mark(pool)
+            assert inner == pool.contents.marks_count - 1, f"Unexpected mark {inner}"
+            
+            prod = chonky_nums.chonky_mul(big_a, big_b)
+            assert to_int(prod) == a * b, f"Pool mul mismatch:\nA = {a:x}\nB = {b:x}"
+            quot = chonky_nums.chonky_div(prod, big_b)
+            assert to_int(quot) == a, f"Pool div mismatch:\nA = {a:x}\nB = {b:x}"
+            if random.randint(0, 1): chonky_nums.chonky_pool_reset(pool, inner)
+            
+            assert chonky_nums.chonky_add_into(kept, big_a, big_b), "chonky_add_into failed"
+            assert to_int(kept) == a + b, f"Pool add mismatch:\nA = {a:x}\nB = {b:x}"
+            chonky_nums.dealloc_chonky_num(big_b)
+
+        chonky_nums.chonky_pool_reset(pool, mark)
+        assert pool.contents.marks_count == 0, "The marks were not released"
+
+    # Grown in place past the biggest class, and then again as a large block,
+    # the content has to survive every move
+    a = random.getrandbits(4096) | 1
+    grown = to_big(chonky_nums, a, 8 * (4096 // 64 + 1))
+    expected = a
+    for bit_cnt in [1 << 21, 1 << 22, 1 << 23]:
+        assert chonky_nums.chonky_shl_into(grown, grown, bit_cnt), "chonky_shl_into failed"
+        expected <<= bit_cnt
+        assert grown.contents.is_pooled, "The number left the pool"
+        assert to_int(grown) == expected, f"Pool grow mismatch after {bit_cnt} bits"
+    chonky_nums.dealloc_chonky_num(grown)
+
+    # Contexts, along with their tables, come from the pool as well
+    a = random.getrandbits(1024)
+    b = random.getrandbits(256)
+    c = random.getrandbits(1024) | (1 << 1023) | 1
+    big_a = to_big(chonky_nums, a, 8 * 16)
+    big_b = to_big(chonky_nums, b, 8 * 4)
+    big_c = to_big(chonky_nums, c, 8 * 16)
+    fixed = chonky_nums.alloc_chonky_fixed_base(big_a, big_c, 256, 0, 0)
+    assert fixed, "alloc_chonky_fixed_base failed"
+    assert fixed.contents.is_pooled and fixed.contents.mont.contents.is_pooled and fixed.contents.barrett.contents.is_pooled, "The context was not allocated from the pool"
+    res = chonky_nums.chonky_fixed_base_pow_mod(big_b, fixed)
+    assert to_int(res) == pow(a, b, c), f"Pool fixed base mismatch:\nA = {a:x}\nB = {b:x}\nC = {c:x}"
+
+    # Numbers and contexts from the pool can still be freed once it is uninstalled
+    assert chonky_nums.chonky_pool_use(None), "The pool was not installed"
+    chonky_nums.dealloc_chonky_fixed_base(fixed)
+    chonky_nums.dealloc_chonky_num(kept)
+    chonky_nums.dealloc_chonky_pool(pool)
+    
+    return
+
+@timed
+def test_fixed_width(chonky_nums):   
+    # The kernels are generated by a macro, so that they are called directly
+    lib = chonky_nums.chonky_nums
+    for bits, n in [(256, 4), (384, 6), (512, 8), (2048, 32), (4096, 64)]:
+        Fixed = ctypes.c_uint64 * n
+        Wide = ctypes.c_uint64 * (2 * n)
+        class Mont(ctypes.Structure):
+            _fields_ = [("mod", Fixed), ("r2", Fixed), ("m_inv", ctypes.c_uint64)]
+
+        def kernel(name, restype = None):
+            func = getattr(lib, f"chonky_u{bits}_{name}")
+            func.restype = restype
+            return func
+
+        def to_fixed(x, size = n):
+            return (ctypes.c_uint64 * size)(*[(x >> (64 * i)) & ((1 << 64) - 1) for i in range(size)])
+
+        def from_fixed(limbs):
+            return sum(limb << (64 * i) for i, limb in enumerate(limbs))
+
+        for _ in range(200):
+            a = random.getrandbits(64 * n)
+            b = random.getrandbits(64 * n)
+            # Odd moduli, with and without the top limb in use
+            m = random.getrandbits(random.choice([64 * n, 64 * n - 64, 64 * n - 1])) | 1
+            fixed_a, fixed_b, res, wide = to_fixed(a), to_fixed(b), Fixed(), Wide()
+            
+            carry = kernel("add", ctypes.c_uint64)(ctypes.byref(res), ctypes.byref(fixed_a), ctypes.byref(fixed_b))
+            assert from_fixed(res) + (carry << (64 * n)) == a + b, f"u{bits} add mismatch:\nA = {a:x}\nB = {b:x}"
+            
+            borrow = kernel("sub", ctypes.c_uint64)(ctypes.byref(res), ctypes.byref(fixed_a), ctypes.byref(fixed_b))
+            assert from_fixed(res) - (borrow << (64 * n)) == a - b, f"u{bits} sub mismatch:\nA = {a:x}\nB = {b:x}"
+            
+            kernel("mul")(ctypes.byref(wide), ctypes.byref(fixed_a), ctypes.byref(fixed_b))
+            assert from_fixed(wide) == a * b, f"u{bits} mul mismatch:\nA = {a:x}\nB = {b:x}"
+            
+            kernel("sqr")(ctypes.byref(wide), ctypes.byref(fixed_a))
+            assert from_fixed(wide) == a * a, f"u{bits} sqr mismatch:\nA = {a:x}"
+
+            ctx = Mont()
+            assert kernel("mont_init", ctypes.c_bool)(ctypes.byref(ctx), ctypes.byref(to_fixed(m))), f"u{bits} mont_init failed"
+            
+            # a * b mod m, through the Montgomery form and back
+            fixed_a, fixed_b = to_fixed(a % m), to_fixed(b % m)
+            kernel("to_mont")(ctypes.byref(fixed_a), ctypes.byref(fixed_a), ctypes.byref(ctx))
+            kernel("to_mont")(ctypes.byref(fixed_b), ctypes.byref(fixed_b), ctypes.byref(ctx))
+            kernel("mont_mul")(ctypes.byref(res), ctypes.byref(fixed_a), ctypes.byref(fixed_b), ctypes.byref(ctx))
+            kernel("from_mont")(ctypes.byref(res), ctypes.byref(res), ctypes.byref(ctx))
+            assert from_fixed(res) == (a * b) % m, f"u{bits} mont_mul mismatch:\nA = {a:x}\nB = {b:x}\nM = {m:x}\nRes = {from_fixed(res):x}"
+        
+        # Round trip with the BigNums
+        a = random.getrandbits(64 * n)
+        a_bytes = int_to_bytes(a, 8 * n)
+        big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), 8 * n, 0)
+        assert kernel("from_num", ctypes.c_bool)(ctypes.byref(res), big_a) and from_fixed(res) == a, f"u{bits} from_num mismatch"
+        chonky_nums.dealloc_chonky_num(big_a)
+        
+        a_bytes = int_to_bytes(1 << (64 * n), 8 * n + 8)
+        big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), 8 * n + 8, 0)
+        assert not kernel("from_num", ctypes.c_bool)(ctypes.byref(res), big_a), f"u{bits} from_num accepted a number too big"
+        chonky_nums.dealloc_chonky_num(big_a)
+
+    return
+
+@timed
+def test_batch(chonky_nums):   
+    def to_array(nums):
+        return (ctypes.POINTER(BigNum) * len(nums))(*nums)
+
+    for _ in range(100):
+        # Uneven counts and widths, so that the last group is not full
+        count = random.randint(1, 19)
+        bits = random.randint(1, 1024)
+        a = [random.getrandbits(random.randint(0, bits)) * random.choice([-1, 1]) for _ in range(count)]
+        b = [random.getrandbits(random.randint(0, bits)) * random.choice([-1, 1]) for _ in range(count)]
+        e = [random.getrandbits(random.randint(0, 256)) for _ in range(count)]
+        m = [random.getrandbits(random.randint(1, bits)) or 1 for _ in range(count)]
+        size = 8 * ((max(bits, 256) + 63) // 64 + 1)
+        
+        big_a = [to_big(chonky_nums, x, size) for x in a]
+        big_b = [to_big(chonky_nums, x, size) for x in b]
+        big_e = [to_big(chonky_nums, x, size) for x in e]
+        big_m = [to_big(chonky_nums, x, size) for x in m]
+        res = [chonky_nums.alloc_chonky_num(None, 8, 0) for _ in range(count)]
+
+        assert chonky_nums.chonky_add_batch(to_array(res), to_array(big_a), to_array(big_b), count), "chonky_add_batch failed"
+        for i in range(count):
+            assert to_int(res[i]) == a[i] + b[i], f"chonky_add_batch mismatch:\nA = {a[i]:x}\nB = {b[i]:x}\nRes = {to_int(res[i]):x}"
+
+        assert chonky_nums.chonky_mul_batch(to_array(res), to_array(big_a), to_array(big_b), count), "chonky_mul_batch failed"
+        for i in range(count):
+            assert to_int(res[i]) == a[i] * b[i], f"chonky_mul_batch mismatch:\nA = {a[i]:x}\nB = {b[i]:x}\nRes = {to_int(res[i]):x}"
+        
+        assert chonky_nums.chonky_pow_mod_batch(to_array(res), to_array(big_a), to_array(big_e), to_array(big_m), count), "chonky_pow_mod_batch failed"
+        for i in range(count):
+            expected = pow(abs(a[i]), e[i], m[i])
+            assert to_int(res[i]) == expected, f"chonky_pow_mod_batch mismatch:\nA = {a[i]:x}\nE = {e[i]:x}\nM = {m[i]:x}\nRes = {to_int(res[i]):x}\nExp = {expected:x}"
+
+        for big in big_a + big_b + big_e + big_m + res:
+            chonky_nums.dealloc_chonky_num(big)
+
+    return
+
 @timed
 def test_pow(chonky_nums):   
     for i in range(1000):
@@ -242,6 +845,335 @@ def test_mod_mersenne(chonky_nums):
         assert result == expected, f"Mismatch:\nA = {a:x}\nB = {b:x}\nRes = {result:x}\nExp = {expected:x}"
     return
 
+@timed
+def test_mersenne(chonky_nums):   
+    for i in range(200):
+        # c of one, two and more limbs, and too big to fold (through Barrett)
+        k = random.choice([127, 255, 256, 521, 1024, 2048])
+        c = random.choice([random.getrandbits(random.randint(1, 64)), random.getrandbits(min(128, k // 2)), random.getrandbits(k // 2), random.getrandbits(k - 1)]) | 1
+        m = 2 ** k - c
+        m_size = (k + 7) // 8
+        m_bytes = int_to_bytes(m, m_size)
+        big_m = chonky_nums.alloc_chonky_num(ctypes.cast(m_bytes, ctypes.POINTER(ctypes.c_uint8)), m_size, 0)
+        
+        ctx = chonky_nums.alloc_chonky_mersenne(big_m)
+        assert ctx, "Failed to allocate the mersenne context"
+
+        # The same context is reused for both reductions and multiplications
+        for _ in range(10):
+            a = random.getrandbits(random.randint(1, 3 * k))
+            b = random.getrandbits(k)
+            
+            a_bytes = int_to_bytes(a, 3 * m_size + 8)
+            b_bytes = int_to_bytes(b, m_size)
+            
+            big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), 3 * m_size + 8, 0)
+            big_b = chonky_nums.alloc_chonky_num(ctypes.cast(b_bytes, ctypes.POINTER(ctypes.c_uint8)), m_size, 0)
+
+            res = chonky_nums.chonky_mersenne_reduce(big_a, ctx)
+            assert res, "Failed to reduce"
+            result = bytes_to_int(ctypes.string_at(res.contents.data, res.contents.size))
+            chonky_nums.dealloc_chonky_num(res)
+            
+            assert result == a % m, f"Mismatch:\nA = {a:x}\nM = {m:x}\nRes = {result:x}\nExp = {a % m:x}"
+            
+            res = chonky_nums.chonky_mersenne_mul_mod(big_a, big_b, ctx)
+            assert res, "Failed to multiply"
+            result = bytes_to_int(ctypes.string_at(res.contents.data, res.contents.size))
+            chonky_nums.dealloc_chonky_num(res)
+            
+            chonky_nums.dealloc_chonky_num(big_a)
+            chonky_nums.dealloc_chonky_num(big_b)
+
+            assert result == (a * b) % m, f"Mismatch:\nA = {a:x}\nB = {b:x}\nM = {m:x}\nRes = {result:x}\nExp = {(a * b) % m:x}"
+        
+        chonky_nums.dealloc_chonky_mersenne(ctx)
+        chonky_nums.dealloc_chonky_num(big_m)
+    
+    return
+
+@timed
+def test_gcd(chonky_nums):   
+    def gcd(a, b):
+        while b:
+            a, b = b, a % b
+        return abs(a)
+
+    for i in range(1000):
+        # Operands of unbalanced sizes, sharing a random factor
+        common = random.getrandbits(random.choice([1, 64, 256]))
+        a = random.getrandbits(random.randint(0, 2048)) * common * random.choice([-1, 1])
+        b = random.getrandbits(random.randint(0, 2048)) * common * random.choice([-1, 1])
+        size = 8 * ((max(a.bit_length(), b.bit_length()) + 63) // 64 + 1)
+        big_a = to_big(chonky_nums, a, size)
+        big_b = to_big(chonky_nums, b, size)
+        expected = gcd(a, b)
+
+        res = chonky_nums.chonky_gcd(big_a, big_b)
+        assert res and to_int(res) == expected, f"chonky_gcd mismatch:\nA = {a:x}\nB = {b:x}\nRes = {to_int(res):x}\nExp = {expected:x}"
+        chonky_nums.dealloc_chonky_num(res)
+
+        big_x = ctypes.POINTER(BigNum)()
+        big_y = ctypes.POINTER(BigNum)()
+        res = chonky_nums.chonky_gcd_ext(big_a, big_b, ctypes.byref(big_x), ctypes.byref(big_y))
+        assert res, "chonky_gcd_ext failed"
+        g, x, y = to_int(res), to_int(big_x), to_int(big_y)
+        assert g == expected and a * x + b * y == g, f"chonky_gcd_ext mismatch:\nA = {a:x}\nB = {b:x}\nG = {g:x}\nX = {x:x}\nY = {y:x}"
+        chonky_nums.dealloc_chonky_num(res)
+        chonky_nums.dealloc_chonky_num(big_x)
+        chonky_nums.dealloc_chonky_num(big_y)
+        
+        # Aliasing the gcd with an operand
+        assert chonky_nums.chonky_gcd_into(big_a, big_a, big_b) and to_int(big_a) == expected, f"chonky_gcd_into (res == a) mismatch:\nA = {a:x}\nB = {b:x}"
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_b)
+
+    for i in range(500):
+        m = random.getrandbits(random.choice([64, 521, 2048])) | 1
+        a = random.getrandbits(random.randint(1, 2 * m.bit_length())) * random.choice([-1, 1])
+        size = 8 * ((max(a.bit_length(), m.bit_length()) + 63) // 64 + 1)
+        big_a = to_big(chonky_nums, a, size)
+        big_m = to_big(chonky_nums, m, size)
+        
+        res = chonky_nums.chonky_invert(big_a, big_m)
+        if gcd(a, m) != 1:
+            assert not res, f"chonky_invert accepted a number not coprime with the modulus:\nA = {a:x}\nM = {m:x}"
+        else:
+            expected = pow(a, -1, m)
+            assert res and to_int(res) == expected, f"chonky_invert mismatch:\nA = {a:x}\nM = {m:x}\nRes = {to_int(res):x}\nExp = {expected:x}"
+            chonky_nums.dealloc_chonky_num(res)
+
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_m)
+
+    return
+
+@timed
+def test_barrett(chonky_nums):   
+    for i in range(200):
+        c = random.getrandbits(random.choice([64, 512, 2048])) & ~1
+        c_size = len(int_to_bytes(c, (c.bit_length() + 7) // 8))
+        c_bytes = int_to_bytes(c, c_size)
+        big_c = chonky_nums.alloc_chonky_num(ctypes.cast(c_bytes, ctypes.POINTER(ctypes.c_uint8)), c_size, 0)
+        
+        ctx = chonky_nums.alloc_chonky_barrett(big_c)
+        assert ctx, "Failed to allocate the barrett context"
+
+        # The same context is reused for both reductions and multiplications
+        for _ in range(10):
+            a = random.getrandbits(random.randint(1, 3 * c.bit_length()))
+            b = random.getrandbits(c.bit_length())
+            
+            a_bytes = int_to_bytes(a, 8 * c_size)
+            b_bytes = int_to_bytes(b, 8 * c_size)
+            
+            big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), 8 * c_size, 0)
+            big_b = chonky_nums.alloc_chonky_num(ctypes.cast(b_bytes, ctypes.POINTER(ctypes.c_uint8)), 8 * c_size, 0)
+
+            res = chonky_nums.chonky_barrett_reduce(big_a, ctx)
+            assert res, "Failed to reduce"
+            result = bytes_to_int(ctypes.string_at(res.contents.data, res.contents.size))
+            chonky_nums.dealloc_chonky_num(res)
+            
+            assert result == a % c, f"Mismatch:\nA = {a:x}\nC = {c:x}\nRes = {result:x}\nExp = {a % c:x}"
+            
+            res = chonky_nums.chonky_barrett_mul_mod(big_a, big_b, ctx)
+            assert res, "Failed to multiply"
+            result = bytes_to_int(ctypes.string_at(res.contents.data, res.contents.size))
+            chonky_nums.dealloc_chonky_num(res)
+            
+            chonky_nums.dealloc_chonky_num(big_a)
+            chonky_nums.dealloc_chonky_num(big_b)
+
+            assert result == (a * b) % c, f"Mismatch:\nA = {a:x}\nB = {b:x}\nC = {c:x}\nRes = {result:x}\nExp = {(a * b) % c:x}"
+        
+        chonky_nums.dealloc_chonky_barrett(ctx)
+        chonky_nums.dealloc_chonky_num(big_c)
+    
+    return
+
+@timed
+def test_fixed_base(chonky_nums):   
+    configs = [(0, 0), (1, 1), (3, 1), (5, 3), (8, 4)]
+    for i in range(60):
+        c = random.getrandbits(random.choice([64, 512, 1024])) | 1
+        if i % 2: c &= ~1
+        c = max(c, 2)
+        c_size = len(int_to_bytes(c, (c.bit_length() + 7) // 8))
+        c_bytes = int_to_bytes(c, c_size)
+        big_c = chonky_nums.alloc_chonky_num(ctypes.cast(c_bytes, ctypes.POINTER(ctypes.c_uint8)), c_size, 0)
+        
+        a = random.getrandbits(random.randint(1, 2 * c.bit_length()))
+        a_bytes = int_to_bytes(a, 2 * c_size)
+        big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), 2 * c_size, 0)
+        
+        max_exp_bits = random.choice([1, 64, 256, c.bit_length()])
+        window, tables = configs[i % len(configs)]
+        ctx = chonky_nums.alloc_chonky_fixed_base(big_a, big_c, max_exp_bits, window, tables)
+        assert ctx, "Failed to allocate the fixed base context"
+
+        # The same table is reused for every exponent
+        for _ in range(10):
+            b = random.getrandbits(random.randint(0, max_exp_bits))
+            b_bytes = int_to_bytes(b, 8 * ((max_exp_bits + 63) // 64))
+            big_b = chonky_nums.alloc_chonky_num(ctypes.cast(b_bytes, ctypes.POINTER(ctypes.c_uint8)), len(b_bytes), 0)
+
+            res = chonky_nums.chonky_fixed_base_pow_mod(big_b, ctx)
+            assert res, "Failed to exponentiate"
+            result = bytes_to_int(ctypes.string_at(res.contents.data, res.contents.size))
+            chonky_nums.dealloc_chonky_num(res)
+            chonky_nums.dealloc_chonky_num(big_b)
+            
+            expected = pow(a, b, c)
+            assert result == expected, f"Mismatch:\nA = {a:x}\nB = {b:x}\nC = {c:x}\nRes = {result:x}\nExp = {expected:x}"
+        
+        chonky_nums.dealloc_chonky_fixed_base(ctx)
+        chonky_nums.dealloc_chonky_num(big_a)
+        chonky_nums.dealloc_chonky_num(big_c)
+    
+    return
+
+@timed
+def test_crt(chonky_nums):   
+    def gcd(a, b):
+        while b:
+            a, b = b, a % b
+        return a
+
+    def random_prime(bits):
+        while True:
+            p = random.getrandbits(bits) | (1 << (bits - 1)) | 1
+            if is_probable_prime(p): return p
+
+    # Any coprime odd factors, with the full exponent as dp and dq
+    for i in range(100):
+        p = random.getrandbits(random.choice([64, 256, 1024])) | 1
+        q = random.getrandbits(random.choice([64, 256, 1024])) | 1
+        if p < 3 or q < 3 or gcd(p, q) != 1: continue
+        d = random.getrandbits(random.randint(0, 512))
+        qinv = pow(q, -1, p)
+        big_p, big_q, big_d, big_qinv = to_big(chonky_nums, p), to_big(chonky_nums, q), to_big(chonky_nums, d), to_big(chonky_nums, qinv)
+        ctx = chonky_nums.alloc_chonky_crt(big_p, big_q, big_d, big_d, big_qinv)
+        assert ctx, "Failed to allocate the crt context"
+
+        for _ in range(5):
+            x = random.getrandbits(random.randint(1, 2 * (p * q).bit_length()))
+            big_x = to_big(chonky_nums, x)
+            res = chonky_nums.chonky_pow_mod_crt(big_x, ctx)
+            assert res, "Failed to exponentiate"
+            expected = pow(x, d, p * q)
+            assert to_int(res) == expected, f"chonky_pow_mod_crt mismatch:\nX = {x:x}\nD = {d:x}\nP = {p:x}\nQ = {q:x}\nRes = {to_int(res):x}\nExp = {expected:x}"
+            chonky_nums.dealloc_chonky_num(res)
+            chonky_nums.dealloc_chonky_num(big_x)
+
+        chonky_nums.dealloc_chonky_crt(ctx)
+        for big in (big_p, big_q, big_d, big_qinv): chonky_nums.dealloc_chonky_num(big)
+
+    # RSA-like keys, with the second half of them splitting the halves on the workers
+    for i in range(12):
+        if i == 6: assert chonky_nums.chonky_set_workers(2) == 2, "Failed to start the workers"
+        bits = random.choice([64, 512, 1024])
+        p, q = random_prime(bits), random_prime(random.choice([bits, bits + 64]))
+        if p == q: continue
+        n, phi = p * q, (p - 1) * (q - 1)
+        e = 65537
+        if gcd(e, phi) != 1: continue
+        d = pow(e, -1, phi)
+        big_p, big_q, big_d = to_big(chonky_nums, p), to_big(chonky_nums, q), to_big(chonky_nums, d)
+        ctx = chonky_nums.alloc_chonky_crt_from_exp(big_p, big_q, big_d)
+        assert ctx, "Failed to derive the crt context"
+
+        for _ in range(5):
+            x = random.randrange(n)
+            big_x = to_big(chonky_nums, pow(x, e, n), size_of(n))
+            
+            # Aliasing the result with the base
+            assert chonky_nums.chonky_pow_mod_crt_into(big_x, big_x, ctx), "Failed to exponentiate"
+            assert to_int(big_x) == x, f"chonky_pow_mod_crt_into mismatch:\nX = {x:x}\nP = {p:x}\nQ = {q:x}\nRes = {to_int(big_x):x}"
+            chonky_nums.dealloc_chonky_num(big_x)
+
+        chonky_nums.dealloc_chonky_crt(ctx)
+        for big in (big_p, big_q, big_d): chonky_nums.dealloc_chonky_num(big)
+
+    assert chonky_nums.chonky_set_workers(0) == 0, "Failed to stop the workers"
+
+    return
+
+@timed
+def test_multi_pow(chonky_nums):   
+    def to_array(nums):
+        return (ctypes.POINTER(BigNum) * len(nums))(*nums)
+
+    # Counts on both sides of CHONKY_PIPPENGER_THRESHOLD, with odd and even moduli
+    for i in range(150):
+        count = random.choice([0, 1, 2, 3, random.randint(4, 64), random.randint(65, 150)])
+        m = random.getrandbits(random.choice([64, 256, 1024])) | (i % 2)
+        m = max(m, 1)
+        size = 8 * ((m.bit_length() + 63) // 64 + 1)
+        a = [random.getrandbits(random.randint(0, 2 * m.bit_length())) for _ in range(count)]
+        e = [random.getrandbits(random.choice([0, 1, 64, random.randint(1, 512)])) for _ in range(count)]
+        big_a = [to_big(chonky_nums, x, 2 * size) for x in a]
+        big_e = [to_big(chonky_nums, x, 8 * ((x.bit_length() + 63) // 64 + 1)) for x in e]
+        big_m = to_big(chonky_nums, m, size)
+
+        expected = 1 % m
+        for x, y in zip(a, e): expected = expected * pow(x, y, m) % m
+
+        res = chonky_nums.chonky_multi_pow_mod(to_array(big_a), to_array(big_e), count, big_m)
+        assert res, "chonky_multi_pow_mod failed"
+        assert to_int(res) == expected, f"chonky_multi_pow_mod mismatch ({count} bases):\nM = {m:x}\nRes = {to_int(res):x}\nExp = {expected:x}"
+        chonky_nums.dealloc_chonky_num(res)
+
+        # Aliasing the result with the first base
+        if count > 0:
+            assert chonky_nums.chonky_multi_pow_mod_into(big_a[0], to_array(big_a), to_array(big_e), count, big_m), "chonky_multi_pow_mod_into failed"
+            assert to_int(big_a[0]) == expected, f"chonky_multi_pow_mod_into (res == nums[0]) mismatch ({count} bases):\nM = {m:x}"
+
+        for big in big_a + big_e + [big_m]:
+            chonky_nums.dealloc_chonky_num(big)
+
+    return
+
+@timed
+def test_primes(chonky_nums):   
+    def check(x, rounds = 0):
+        big_x = to_big(chonky_nums, x)
+        expected = is_probable_prime(abs(x))
+        assert chonky_nums.chonky_is_probable_prime(big_x, rounds) == expected, f"chonky_is_probable_prime mismatch for {x:x}, expected {expected}"
+        assert chonky_nums.chonky_miller_rabin(big_x, 8) == expected, f"chonky_miller_rabin mismatch for {x:x}, expected {expected}"
+        chonky_nums.dealloc_chonky_num(big_x)
+
+    # Every small number, across the bound settled by trial division alone
+    for x in range(-10, 3000): check(x)
+    for _ in range(3000): check(random.randint(300_000_000, 1 << 40))
+
+    # Mersenne primes and composites, Carmichael numbers and strong pseudoprimes to base 2
+    for e in (61, 67, 89, 107, 127, 521, 607, 1279): check((1 << e) - 1, 2)
+    for x in (561, 41041, 825265, 321197185, 2047, 1373653, 25326001, 3215031751, 2152302898747, 3474749660383, 341550071728321, 3825123056546413051):
+        check(x)
+
+    # Products of two big primes, squares of primes and random odd numbers
+    primes = []
+    for i in range(80):
+        bits = random.choice([64, 100, 256, 512, 1024])
+        x = random.getrandbits(bits) | (1 << (bits - 1)) | 1
+        while not is_probable_prime(x): x += 2
+        primes.append(x)
+        check(x, i % 3)
+        check(x * random.choice(primes))
+        check(random.getrandbits(bits) | 1)
+
+    # Generated primes take exactly the requested bits, with the top two set
+    for bits in list(range(2, 70)) + [random.randint(70, 1100) for _ in range(15)]:
+        res = chonky_nums.chonky_gen_prime(bits, bits % 3)
+        assert res, f"chonky_gen_prime failed for {bits} bits"
+        p = to_int(res)
+        assert p.bit_length() == bits and (bits < 2 or p >> (bits - 2) == 3), f"chonky_gen_prime gave {p:x} for {bits} bits"
+        assert is_probable_prime(p), f"chonky_gen_prime gave the composite {p:x}"
+        chonky_nums.dealloc_chonky_num(res)
+
+    return
+
 @timed
 def test_pow_mod(chonky_nums):   
     for i in range(1000):
@@ -282,6 +1214,98 @@ def test_pow_mod(chonky_nums):
     
     return
 
+@timed
+def test_ifma(chonky_nums):   
+    # Sweeps the sizes around the kernel thresholds, on CPUs without IFMA
+    # the same checks go through the scalar kernels
+    for n in range(1, 65):
+        for _ in range(4):
+            a = random.getrandbits(64 * n)
+            b = random.getrandbits(64 * random.randint(1, n))
+            big_a, big_b = to_big(chonky_nums, a, 8 * n), to_big(chonky_nums, b, 8 * n)
+
+            res = chonky_nums.chonky_mul(big_a, big_b)
+            assert res, "Failed to multiply"
+            assert to_int(res) == a * b, f"Mismatch:\nA = {a:x}\nB = {b:x}\nRes = {to_int(res):x}\nExp = {a * b:x}"
+            chonky_nums.dealloc_chonky_num(res)
+
+            res = chonky_nums.chonky_sqr(big_a)
+            assert res, "Failed to square"
+            assert to_int(res) == a * a, f"Mismatch:\nA = {a:x}\nRes = {to_int(res):x}\nExp = {a * a:x}"
+            chonky_nums.dealloc_chonky_num(res)
+            
+            chonky_nums.dealloc_chonky_num(big_a)
+            chonky_nums.dealloc_chonky_num(big_b)
+
+        # Moduli right below 2^(64 * n) stress the final subtraction
+        for c in [random.getrandbits(64 * n) | (1 << (64 * n - 1)) | 1, (1 << (64 * n)) - 2 * random.getrandbits(16) - 1]:
+            big_c = to_big(chonky_nums, c, 8 * n)
+            ctx = chonky_nums.alloc_chonky_montgomery(big_c)
+            assert ctx, "Failed to allocate the montgomery context"
+
+            a = random.getrandbits(64 * n) % c
+            e = random.getrandbits(128)
+            big_a, big_e = to_big(chonky_nums, a, 8 * n), to_big(chonky_nums, e, 16)
+            
+            res = chonky_nums.chonky_pow_mod_montgomery(big_a, big_e, ctx)
+            assert res, "Failed to exponentiate"
+            assert to_int(res) == pow(a, e, c), f"Mismatch:\nA = {a:x}\nE = {e:x}\nC = {c:x}\nRes = {to_int(res):x}\nExp = {pow(a, e, c):x}"
+            
+            chonky_nums.dealloc_chonky_num(res)
+            chonky_nums.dealloc_chonky_num(big_a)
+            chonky_nums.dealloc_chonky_num(big_e)
+            chonky_nums.dealloc_chonky_montgomery(ctx)
+            chonky_nums.dealloc_chonky_num(big_c)
+
+    return
+
+@timed
+def test_pow_mod_montgomery(chonky_nums):   
+    for i in range(100):
+        print(f"Testing {i + 1} out of 100", end='\r')
+        
+        c = random.getrandbits(2048) | 1
+        c_bytes = int_to_bytes(c, 256)
+        big_c = chonky_nums.alloc_chonky_num(ctypes.cast(c_bytes, ctypes.POINTER(ctypes.c_uint8)), 256, 0)
+        
+        ctx = chonky_nums.alloc_chonky_montgomery(big_c)
+        assert ctx, "Failed to allocate the montgomery context"
+
+        # The same context is reused across several exponentiations
+        for _ in range(4):
+            a = random.getrandbits(2048)
+            b = random.getrandbits(random.choice([17, 256, 2048]))
+            expected = pow(a, b, c)
+            
+            a_bytes = int_to_bytes(a, 256)
+            b_bytes = int_to_bytes(b, 256)
+            
+            big_a = chonky_nums.alloc_chonky_num(ctypes.cast(a_bytes, ctypes.POINTER(ctypes.c_uint8)), 256, 0)
+            big_b = chonky_nums.alloc_chonky_num(ctypes.cast(b_bytes, ctypes.POINTER(ctypes.c_uint8)), 256, 0)
+
+            res = chonky_nums.chonky_pow_mod_montgomery(big_a, big_b, ctx)
+            if not res:
+                chonky_nums.dealloc_chonky_num(big_a)
+                chonky_nums.dealloc_chonky_num(big_b)
+                continue
+            
+            result = bytes_to_int(ctypes.string_at(res.contents.data, res.contents.size))
+
+            # Fix Sign
+            result *= 1 - 2 * res.contents.sign
+            
+            chonky_nums.dealloc_chonky_num(big_a)
+            chonky_nums.dealloc_chonky_num(big_b)
+            chonky_nums.dealloc_chonky_num(res)
+
+            assert result == expected, f"Mismatch:\nA = {a:x}\nB = {b:x}\nC = {c:x}\nRes = {result:x}\nExp = {expected:x}"
+        
+        chonky_nums.dealloc_chonky_montgomery(ctx)
+        chonky_nums.dealloc_chonky_num(big_c)
+    print("                                                         ") 
+    
+    return
+
 @timed
 def test_pow_mod_mersenne(chonky_nums):   
     c = 2 ** 255 - 19
@@ -326,6 +1350,12 @@ def test_pow_mod_mersenne(chonky_nums):
 if __name__ == "__main__":
     chonky_nums = ChonkyNums()
 
+    print("Testing alloc_chonky_num_from_string...")
+    test_from_string(chonky_nums)
+
+    print("Testing chonky_to_dec_string...")
+    test_to_dec_string(chonky_nums)
+
     print("Testing chonky_add...")
     test_add(chonky_nums)
     
@@ -335,9 +1365,45 @@ if __name__ == "__main__":
     print("Testing chonky_mul...")
     test_mul(chonky_nums)
     
+    print("Testing chonky_mul (large operands)...")
+    test_mul_large(chonky_nums)
+
+    print("Testing parallel multiplication...")
+    test_workers(chonky_nums)
+
+    print("Testing NTT multiplication...")
+    test_ntt(chonky_nums)
+    
+    print("Testing chonky_sqr...")
+    test_sqr(chonky_nums)
+    
     print("Testing chonky_div...")
     test_div(chonky_nums)
 
+    print("Testing chonky_divmod...")
+    test_divmod(chonky_nums)
+
+    print("Testing _into variants...")
+    test_into(chonky_nums)
+
+    print("Testing chonky_shl/chonky_shr and the bitwise operations...")
+    test_bitwise(chonky_nums)
+
+    print("Testing used limbs...")
+    test_limbs(chonky_nums)
+
+    print("Testing inline limbs...")
+    test_inline(chonky_nums)
+
+    print("Testing memory pool...")
+    test_pool(chonky_nums)
+
+    print("Testing batch operations...")
+    test_batch(chonky_nums)
+
+    print("Testing fixed width kernels...")
+    test_fixed_width(chonky_nums)
+
     print("Testing chonky_pow...")
     test_pow(chonky_nums)
 
@@ -347,9 +1413,36 @@ if __name__ == "__main__":
     print("Testing chonky_mod_mersenne...")
     test_mod_mersenne(chonky_nums)
 
+    print("Testing chonky_gcd/chonky_gcd_ext/chonky_invert...")
+    test_gcd(chonky_nums)
+
+    print("Testing chonky_barrett_reduce/chonky_barrett_mul_mod...")
+    test_barrett(chonky_nums)
+
+    print("Testing chonky_mersenne_reduce/chonky_mersenne_mul_mod...")
+    test_mersenne(chonky_nums)
+
     print("Testing chonky_pow_mod...")
     test_pow_mod(chonky_nums)
 
+    print("Testing chonky_pow_mod_montgomery...")
+    test_pow_mod_montgomery(chonky_nums)
+
+    print("Testing IFMA kernels...")
+    test_ifma(chonky_nums)
+
+    print("Testing chonky_fixed_base_pow_mod...")
+    test_fixed_base(chonky_nums)
+
+    print("Testing chonky_pow_mod_crt...")
+    test_crt(chonky_nums)
+
+    print("Testing chonky_multi_pow_mod...")
+    test_multi_pow(chonky_nums)
+
+    print("Testing chonky_is_probable_prime/chonky_gen_prime...")
+    test_primes(chonky_nums)
+
     print("Testing chonky_pow_mod_mersenne...")
     test_pow_mod_mersenne(chonky_nums)
 